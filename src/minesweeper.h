@@ -1,12 +1,29 @@
 #ifndef MINESWEEPER_H
 #define MINESWEEPER_H
 
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <time.h>
 #include <assert.h>
+#include <limits.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <termios.h>
+#include <signal.h>
+#include <poll.h>
+#endif
 
 // =====================
 //  DEFINES
@@ -16,6 +33,34 @@
 #define col_amount 16
 #define mine_amount 32
 
+#define beginner_rows 9
+#define beginner_cols 9
+
+#define intermediate_rows 16
+#define intermediate_cols 16
+
+#define expert_rows 30
+#define expert_cols 16
+
+#define key_up 1000
+#define key_down 1001
+#define key_left 1002
+#define key_right 1003
+#define key_eof 1004
+
+#define move_reveal 0
+#define move_flag 1
+#define move_chord 2
+
+#define move_applied 1
+#define move_unchanged 0
+#define move_invalid -1
+#define move_exploded -2
+#define move_skipped -3
+
+#define journal_cell 0
+#define journal_move 1
+
 #define mine_char '*'
 #define starting_char 'X'
 #define flag_char '?'
@@ -43,6 +88,46 @@ typedef struct
     char data;
 } Vector2D;
 
+typedef struct
+{
+    int row;
+    int col;
+    char prev;
+    char kind;
+    char game_over;
+} journal_entry;
+
+typedef struct
+{
+    int start;
+    int len;
+} cell_span;
+
+typedef struct
+{
+    int row;
+    int col;
+    int type;
+} batch_move;
+
+typedef struct
+{
+    int row;
+    int col;
+    char data;
+} cell_event;
+
+typedef struct
+{
+    cell_event *events;
+    size_t mask;
+    _Atomic size_t head;
+    _Atomic size_t tail;
+    _Atomic size_t dropped;
+} cell_event_ring;
+
+typedef void (*cell_event_callback)(const cell_event *event, void *userdata);
+
 typedef struct
 {
     Vector2D **hidden_matrix;
@@ -53,8 +138,63 @@ typedef struct
     int game_over;
     int mines_initialized;
     int current_seed;
+    uint64_t rng_state;
+    journal_entry *journal;
+    size_t journal_len;
+    size_t journal_cap;
+    uint64_t hash;
+    int64_t revealed_safe;
+    int64_t safe_total;
+    int *region_of;
+    int *region_offsets;
+    cell_span *region_spans;
+    int *region_flags;
+    int region_count;
+    char *region_buffer;
+    size_t region_buffer_size;
+    size_t region_used;
+    cell_event_ring *event_ring;
+    cell_event_callback event_callback;
+    void *event_userdata;
+    char *hidden_plane;
+    char *visible_plane;
+    void *mapped_base;
+    size_t mapped_size;
 } minesweeper_struct;
 
+typedef struct
+{
+    minesweeper_struct *game;
+    int cursor_row;
+    int cursor_col;
+} raw_view;
+
+typedef struct
+{
+    _Atomic uint64_t key;
+    _Atomic uint64_t data;
+} transposition_entry;
+
+typedef struct
+{
+    transposition_entry *entries;
+    size_t mask;
+} transposition_table;
+
+typedef struct
+{
+    char *cells;
+    unsigned char *mines;
+    uint32_t *needed;
+    uint64_t *rng_state;
+    int rows;
+    int cols;
+    int mines_amt;
+    int lanes;
+    int safe_row;
+    int safe_col;
+} minesweeper_batch;
+
 // =====================
 //  COLORS
 // =====================
@@ -144,32 +284,126 @@ Vector2D **init_hidden_matrix(int rows, int cols, char startingChar);
 // @param value: Character to set as the cell's data
 void set_matrix_data(Vector2D **matrix, int row, int col, char value);
 
+// Mapped games keep each board as a plane of one byte per cell instead of a Vector2D matrix.
+// A zero byte reads as starting_char, so a freshly created sparse file is already a blank board
+
+// _hiddenAt(): Read a cell of the hidden board, from the matrix or the mapped plane
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @return: The cell's character
+char _hiddenAt(const minesweeper_struct *game, int row, int col);
+
+// _visibleAt(): Read a cell of the visible board, from the matrix or the mapped plane
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @return: The cell's character
+char _visibleAt(const minesweeper_struct *game, int row, int col);
+
 // =====================
 //  GAME API
 // =====================
 
 // _renderNumbers(): Calculate and set the number of adjacent mines for each cell
+// Dispatches to a fixed-size variant for the beginner, intermediate and expert presets
 // @param matrix: The matrix representing the board
 // @param rows: Number of rows
 // @param cols: Number of columns
 void _renderNumbers(Vector2D **matrix, int rows, int cols);
 
 // _renderMines(): Randomly place mines in the matrix while avoiding the safe zone
+// Uses selection sampling in raster order: no per-cell buffer, and a file-backed board is written sequentially.
+// Dispatches to a fixed-size variant for the beginner, intermediate and expert presets
 // @param matrix: The matrix representing the board
 // @param rows: Number of rows
 // @param cols: Number of columns
 // @param mineCount: Total number of mines to place
 // @param safe_row: Row of the initial safe move
 // @param safe_col: Column of the initial safe move
-void _renderMines(Vector2D **matrix, int rows, int cols, int mineCount, int safe_row, int safe_col);
+// @param rng_state: Pointer to the game's random stream, advanced in place
+// @return: Number of mines placed, less than mineCount only if the safe zone leaves too few cells
+int _renderMines(Vector2D **matrix, int rows, int cols, int mineCount, int safe_row, int safe_col,
+        uint64_t *rng_state);
+
+// _renderMinesPlane(): Place mines on a mapped hidden plane, drawing the same stream as _renderMines()
+// A seed therefore yields the same board mapped or in memory; cell indices are 64-bit
+// @param plane: The hidden plane, rows * cols bytes
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mineCount: Total number of mines to place
+// @param safe_row: Row of the initial safe move
+// @param safe_col: Column of the initial safe move
+// @param rng_state: Pointer to the game's random stream, advanced in place
+// @return: Number of mines placed, less than mineCount only if the safe zone leaves too few cells
+int _renderMinesPlane(char *plane, int rows, int cols, int mineCount, int safe_row, int safe_col,
+        uint64_t *rng_state);
+
+// _renderNumbersPlane(): Set the adjacent mine count of every safe cell of a mapped hidden plane
+// Works in place in one sequential pass: only mines are tested, and they are never overwritten
+// @param plane: The hidden plane, rows * cols bytes
+// @param rows: Number of rows
+// @param cols: Number of columns
+void _renderNumbersPlane(char *plane, int rows, int cols);
+
+// _regionRoot(): Find the union-find root of a zero cell, halving the path as it goes
+// @param parent: Parent array indexed by cell
+// @param cell: The cell
+// @return: Index of the root cell
+int _regionRoot(int *parent, int cell);
 
-// _renderMove(): Reveal a cell and recursively reveal adjacent empty cells
+// _regionReserve(): Grow the game's pooled region buffer to at least the given size
+// A built region index is rebased if the buffer moves
+// @param game: Pointer to the game state
+// @param bytes: Required size in bytes
+// @return: Start of the buffer, which may have moved
+char *_regionReserve(minesweeper_struct *game, size_t bytes);
+
+// _cellRegions(): Collect the distinct regions with a zero cell in the 3x3 neighbourhood of a cell
+// @param region_of: Region index of every cell, -1 for non-zero cells
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param r: Row of the cell
+// @param c: Column of the cell
+// @param out: Array of at least 4 entries receiving the regions
+// @return: Number of regions written to out
+int _cellRegions(const int *region_of, int rows, int cols, int r, int c, int *out);
+
+// _renderRegions(): Label every zero-connected region and store its cells plus numbered border as spans
+// Must run after _renderNumbers(); spans are row-major index ranges, grouped per region.
+// Everything lives in one buffer per game that is reused across rebuilds
+// @param game: Pointer to the game state
+void _renderRegions(minesweeper_struct *game);
+
+// _clearRegions(): Invalidate the region index of a game, keeping its buffer for the next build
+// @param game: Pointer to the game state
+void _clearRegions(minesweeper_struct *game);
+
+// _revealRegion(): Reveal every unrevealed cell of a region by walking its spans
+// Dispatches to a fixed-size variant for the beginner, intermediate and expert presets
+// @param game: Pointer to the game state
+// @param region: Index of the region
+void _revealRegion(minesweeper_struct *game, int region);
+
+// _floodReveal(): Reveal a zero cell and the opening around it with an explicit queue
+// Cells are revealed as they are queued, so each zero cell is queued once, and the breadth-first order
+// keeps only the opening's frontier queued. The queue is a ring in the pooled region buffer after
+// the region index, so deep openings never grow the call stack
+// @param game: Pointer to the game state
+// @param row: Row of the zero cell
+// @param col: Column of the zero cell
+void _floodReveal(minesweeper_struct *game, int row, int col);
+
+// _renderMove(): Reveal a cell and every cell of the opening it belongs to
+// In-memory games reveal unflagged openings from the region index; mapped games never build the
+// index, which would scan the whole board, and flood from the clicked cell instead
 // @param game: Pointer to the game state
 // @param row: Row of the move
 // @param col: Column of the move
 void _renderMove(minesweeper_struct *game, int row, int col);
 
 // _revealBoard(): Reveal all cells on the visible matrix by copying from the hidden matrix
+// Journaled as its own step, so one undo takes back the reveal and the next the move before it
 // @param game: Pointer to the game state
 void _revealBoard(minesweeper_struct *game);
 
@@ -179,7 +413,15 @@ void _revealBoard(minesweeper_struct *game);
 // @param col: Column of the cell
 void _toggleFlag(minesweeper_struct *game, int row, int col);
 
+// _chordMove(): Reveal every unflagged neighbour of a number whose flag count matches it
+// @param game: Pointer to the game state
+// @param row: Row of the numbered cell
+// @param col: Column of the numbered cell
+// @return: 1 if the chord was applied, 0 if the cell is not a satisfied number
+int _chordMove(minesweeper_struct *game, int row, int col);
+
 // _checkWin(): Check if the player has won the game
+// Reads the revealed-cell counter kept by _writeVisible(), so it never scans the board
 // @param game: Pointer to the game state
 // @return: 1 if all non-mine cells are revealed, 0 otherwise
 int _checkWin(minesweeper_struct *game);
@@ -209,6 +451,195 @@ void _showSeed(minesweeper_struct *game);
 // @param won: 1 if player won, 0 if player lost
 void _showGameEnd(minesweeper_struct *game, int won);
 
+// =====================
+//  UNDO API
+// =====================
+
+// _journalPush(): Append an entry to the undo journal, growing it if needed
+// @param game: Pointer to the game state
+// @return: Pointer to the new, uninitialized entry
+journal_entry *_journalPush(minesweeper_struct *game);
+
+// _journalBeginMove(): Open an undoable step by pushing a move marker that saves game_over
+// @param game: Pointer to the game state
+// @return: Journal length just after the marker, to pass to _journalEndMove()
+size_t _journalBeginMove(minesweeper_struct *game);
+
+// _journalEndMove(): Close an undoable step, dropping its marker if the step changed nothing
+// @param game: Pointer to the game state
+// @param start: The value returned by _journalBeginMove()
+void _journalEndMove(minesweeper_struct *game, size_t start);
+
+// _writeVisible(): Set a cell on the visible board and update the Zobrist hash, without journaling
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @param value: Character to set as the cell's data
+void _writeVisible(minesweeper_struct *game, int row, int col, char value);
+
+// _setVisible(): Set a cell on the visible matrix and record its previous value in the journal
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @param value: Character to set as the cell's data
+void _setVisible(minesweeper_struct *game, int row, int col, char value);
+
+// minesweeper_make(): Apply a move as a single undoable step
+// @param game: Pointer to the game state
+// @param row: Row of the move
+// @param col: Column of the move
+// @param is_flag: 1 to toggle a flag, 0 to reveal
+void minesweeper_make(minesweeper_struct *game, int row, int col, int is_flag);
+
+// minesweeper_apply_batch(): Apply reveals, flags and chords in one pass as a single undoable step
+// Win and loss are evaluated once, after the last move
+// @param game: Pointer to the game state
+// @param moves: Array of moves; type is move_reveal, move_flag or move_chord
+// @param count: Number of moves
+// @param results: Optional array of count entries receiving move_applied, move_unchanged,
+//                 move_invalid, move_exploded, or move_skipped for moves after a mine was hit
+// @return: 1 if the game is won, -1 if it is lost, 0 if it continues
+int minesweeper_apply_batch(minesweeper_struct *game, const batch_move *moves, int count, int *results);
+
+// minesweeper_unmake(): Roll back the last move made with minesweeper_make() or minesweeper_apply_batch()
+// @param game: Pointer to the game state
+// @return: 1 if a move was undone, 0 if the journal is empty
+int minesweeper_unmake(minesweeper_struct *game);
+
+// =====================
+//  EVENT API
+// =====================
+
+// _emitEvent(): Deliver a cell change to the attached ring buffer and callback, if any
+// @param game: Pointer to the game state
+// @param row: Row of the changed cell
+// @param col: Column of the changed cell
+// @param data: The cell's new visible character
+void _emitEvent(minesweeper_struct *game, int row, int col, char data);
+
+// cell_event_ring_init(): Allocate a single-producer, single-consumer ring of cell events
+// @param capacity: Number of events, rounded up to a power of two
+// @return: Pointer to the allocated ring
+cell_event_ring *cell_event_ring_init(size_t capacity);
+
+// cell_event_ring_push(): Append an event, counting it as dropped if the ring is full
+// @param ring: The ring
+// @param event: The event to append
+// @return: 1 if stored, 0 if dropped
+int cell_event_ring_push(cell_event_ring *ring, const cell_event *event);
+
+// cell_event_ring_pop(): Take the oldest event from the ring
+// @param ring: The ring
+// @param event: Pointer to store the event
+// @return: 1 if an event was taken, 0 if the ring is empty
+int cell_event_ring_pop(cell_event_ring *ring, cell_event *event);
+
+// cell_event_ring_destroy(): Free a ring of cell events
+// @param ring: The ring
+void cell_event_ring_destroy(cell_event_ring *ring);
+
+// minesweeper_set_event_ring(): Attach a ring that receives every visible cell change
+// @param game: Pointer to the game state
+// @param ring: The ring, or NULL to detach
+void minesweeper_set_event_ring(minesweeper_struct *game, cell_event_ring *ring);
+
+// minesweeper_set_event_callback(): Attach a callback invoked for every visible cell change
+// @param game: Pointer to the game state
+// @param callback: The callback, or NULL to detach
+// @param userdata: Pointer passed through to the callback
+void minesweeper_set_event_callback(minesweeper_struct *game, cell_event_callback callback, void *userdata);
+
+// =====================
+//  HASHING API
+// =====================
+
+// _splitMix64(): Mix a 64-bit value into a well distributed 64-bit hash
+// @param x: The value to mix
+// @return: The mixed value
+uint64_t _splitMix64(uint64_t x);
+
+// _nextRandom(): Draw the next value from a per-game random stream
+// Games own their stream, so boards from different threads never share state
+// @param state: Pointer to the stream state, advanced in place
+// @return: A uniformly distributed 64-bit value
+uint64_t _nextRandom(uint64_t *state);
+
+// _zobristKey(): Get the Zobrist key for a cell showing the given character
+// Hidden cells key to 0, so a fresh board hashes without visiting its cells
+// @param cell: Row-major index of the cell
+// @param data: The visible character of the cell
+// @return: The 64-bit key, identical across games and processes
+uint64_t _zobristKey(uint64_t cell, char data);
+
+// _zobristEmpty(): Get the Zobrist hash of a board whose cells are all still hidden
+// Dimensions and mine count are mixed in, so equal-looking positions from different densities differ
+// @param game: Pointer to the game state
+// @return: The 64-bit hash
+uint64_t _zobristEmpty(const minesweeper_struct *game);
+
+// _zobristBoard(): Compute the Zobrist hash of the whole visible board from scratch
+// @param game: Pointer to the game state
+// @return: The 64-bit hash
+uint64_t _zobristBoard(minesweeper_struct *game);
+
+// transposition_table_init(): Allocate a lock-free transposition table
+// @param size: Number of entries, rounded up to a power of two
+// @return: Pointer to the allocated table
+transposition_table *transposition_table_init(size_t size);
+
+// transposition_table_store(): Store a value for a position, replacing whatever shared its slot
+// Hash 0 is reserved to mark empty slots, so a position hashing to 0 is never stored
+// @param table: The table
+// @param hash: Zobrist hash of the position
+// @param data: The value to store
+void transposition_table_store(transposition_table *table, uint64_t hash, uint64_t data);
+
+// transposition_table_probe(): Look up the value stored for a position
+// @param table: The table
+// @param hash: Zobrist hash of the position
+// @param data: Pointer to store the value on a hit
+// @return: 1 on a hit, 0 on a miss, a torn entry, or the reserved hash 0
+int transposition_table_probe(transposition_table *table, uint64_t hash, uint64_t *data);
+
+// transposition_table_destroy(): Free a transposition table
+// @param table: The table
+void transposition_table_destroy(transposition_table *table);
+
+// =====================
+//  BATCH API
+// =====================
+
+// Boards are stored interleaved: cell i of lane k lives at cells[i * lanes + k], so every
+// per-cell step runs across all lanes in one contiguous, vectorisable inner loop
+
+// minesweeper_batch_init(): Allocate storage for generating many boards of the same size at once
+// @param seed: The random seed; each lane derives its own stream from it
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mines_amt: The amount of mines to place on every board
+// @param lanes: Number of boards generated per call
+// @return: Pointer to the allocated batch
+minesweeper_batch *minesweeper_batch_init(int seed, int rows, int cols, int mines_amt, int lanes);
+
+// minesweeper_batch_generate(): Place mines and numbers on every lane of the batch
+// The lane loops are marked for SIMD, so they vectorise at -O2 when built with -fopenmp-simd
+// @param batch: Pointer to the batch
+// @param safe_row: Row of the initial safe move shared by all lanes
+// @param safe_col: Column of the initial safe move shared by all lanes
+void minesweeper_batch_generate(minesweeper_batch *batch, int safe_row, int safe_col);
+
+// minesweeper_batch_load(): Reset a game to a fresh start on one generated lane
+// The visible matrix, undo journal and game_over are cleared, so a game can be reused across lanes.
+// The first reveal must be at (batch->safe_row, batch->safe_col), the cell the batch was generated for
+// @param batch: Pointer to a generated batch
+// @param lane: Index of the board to copy
+// @param game: Pointer to an in-memory game with the same dimensions
+void minesweeper_batch_load(minesweeper_batch *batch, int lane, minesweeper_struct *game);
+
+// minesweeper_batch_destroy(): Free all memory associated with a batch
+// @param batch: Pointer to the batch
+void minesweeper_batch_destroy(minesweeper_batch *batch);
+
 // =====================
 //  BOT API
 // =====================
@@ -218,6 +649,60 @@ void _showGameEnd(minesweeper_struct *game, int won);
 // @param game: Pointer to the minesweeper game struct
 Vector2D *get_Radius(input_coordinate *coords, minesweeper_struct *game, int *out_len);
 
+// =====================
+//  RAW INPUT API
+// =====================
+
+#ifndef _WIN32
+
+// _rawRestoreTerminal(): Show the cursor, reset colours and restore the saved terminal settings
+// Uses only async-signal-safe calls so the signal handler can share it
+void _rawRestoreTerminal(void);
+
+// _rawSignalRestore(): Restore the terminal on SIGINT/SIGTERM, then die by the same signal
+// @param sig: The signal received
+void _rawSignalRestore(int sig);
+
+// _enableRawMode(): Switch stdin to unbuffered, unechoed input
+// The first call also installs SIGINT/SIGTERM handlers and an atexit hook that undo it
+// @param saved: Pointer to store the previous terminal settings
+// @return: 1 on success, 0 if stdin is not a terminal
+int _enableRawMode(struct termios *saved);
+
+// _disableRawMode(): Restore the terminal settings saved by _enableRawMode()
+// @param saved: The previous terminal settings
+void _disableRawMode(const struct termios *saved);
+
+// _readKey(): Wait for a keypress, decoding arrow-key escape sequences
+// @param timeout_ms: Milliseconds to wait, or -1 to block
+// @return: The key, one of key_up/key_down/key_left/key_right, -1 on timeout or interruption,
+//          or key_eof once stdin reaches end of file or hangs up
+int _readKey(int timeout_ms);
+
+// _drawCell(): Redraw a single cell of the visible matrix in place
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @param highlighted: 1 to draw the cell under the cursor
+void _drawCell(minesweeper_struct *game, int row, int col, int highlighted);
+
+// _drawStatus(): Replace the status line below the board
+// @param game: Pointer to the game state
+// @param message: The text to show
+void _drawStatus(minesweeper_struct *game, const char *message);
+
+// _rawEventRedraw(): Cell event callback that redraws only the changed cell
+// @param event: The cell change
+// @param userdata: Pointer to the raw_view
+void _rawEventRedraw(const cell_event *event, void *userdata);
+
+// minesweeper_game_loop_raw(): Cursor-driven game loop reading single keys in raw mode
+// Falls back to minesweeper_game_loop() when stdin is not a terminal
+// @param game: Pointer to the state of an in-memory game
+void minesweeper_game_loop_raw(minesweeper_struct *game);
+
+#endif
+
 // =====================
 //  MAIN API
 // =====================
@@ -230,8 +715,29 @@ Vector2D *get_Radius(input_coordinate *coords, minesweeper_struct *game, int *ou
 // @return: Pointer to the initialized game struct
 minesweeper_struct *minesweeper_init(int seed, int rows, int cols, int mines_amt);
 
-// minesweeper_game_loop(): Main game loop handling input, moves, and win/lose conditions
+// _initGameState(): Set every field of a game apart from its board storage, which must already be assigned and blank
 // @param game: Pointer to the game state
+// @param seed: The random seed to set
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mines_amt: The amount of mines to place
+void _initGameState(minesweeper_struct *game, int seed, int rows, int cols, int mines_amt);
+
+// minesweeper_init_mapped(): Initialize a new game whose hidden and visible planes live in a file-backed mapping
+// Lets the board outgrow RAM: each plane takes one byte per cell, so a 100000x100000 board maps 20 GB.
+// Creating the game touches no cell. The first reveal writes the hidden plane in sequential passes,
+// and later moves touch only the pages they reveal. Only the journal and flood stack use the heap,
+// in proportion to the cells revealed. The text loops and batch_load need an in-memory game
+// @param seed: The random seed to set
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mines_amt: The amount of mines to place
+// @param path: File to create or truncate as backing storage
+// @return: Pointer to the initialized game struct, or NULL if the file cannot be mapped
+minesweeper_struct *minesweeper_init_mapped(int seed, int rows, int cols, int mines_amt, const char *path);
+
+// minesweeper_game_loop(): Main game loop handling input, moves, and win/lose conditions
+// @param game: Pointer to the state of an in-memory game
 void minesweeper_game_loop(minesweeper_struct *game);
 
 // minesweeper_destroy(): Free all memory associated with a minesweeper game
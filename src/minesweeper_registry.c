@@ -230,16 +230,191 @@ void set_matrix_data(Vector2D **matrix, int row, int col, char value)
     matrix[row][col].data = value;
 }
 
+// _hiddenAt(): Read a cell of the hidden board, from the matrix or the mapped plane
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @return: The cell's character
+char _hiddenAt(const minesweeper_struct *game, int row, int col)
+{
+    if (game->hidden_plane == NULL)
+        return game->hidden_matrix[row][col].data;
+
+    char data = game->hidden_plane[(uint64_t)row * game->cols + col];
+
+    return data ? data : starting_char;
+}
+
+// _visibleAt(): Read a cell of the visible board, from the matrix or the mapped plane
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @return: The cell's character
+char _visibleAt(const minesweeper_struct *game, int row, int col)
+{
+    if (game->visible_plane == NULL)
+        return game->visible_matrix[row][col].data;
+
+    char data = game->visible_plane[(uint64_t)row * game->cols + col];
+
+    return data ? data : starting_char;
+}
+
+// =====================
+//  PRESETS
+// =====================
+
+// DEFINE_PRESET_ENGINE(): Generate generation and reveal routines for a fixed board size
+// With constant dimensions the neighbour offsets fold into immediates, the loops unroll, and
+// scratch space fits in fixed-size stack arrays. The generic routines dispatch here on a size match.
+// Mine placement draws the same stream as the generic path, so a seed yields the same board either way.
+// _revealOpening_##name is only reached for openings cut short by a flag; unflagged ones walk the region spans
+#define DEFINE_PRESET_ENGINE(name, R, C)                                                      \
+    static int _renderMines_##name(Vector2D **matrix, int mineCount, int safe_row,            \
+            int safe_col, uint64_t *rng_state)                                                              \
+    {                                                                                         \
+        int eligible = (R) * (C);                                                             \
+                                                                                              \
+        for (int r = safe_row - 1; r <= safe_row + 1; r++)                                    \
+            for (int c = safe_col - 1; c <= safe_col + 1; c++)                                \
+                if (r >= 0 && r < (R) && c >= 0 && c < (C))                                   \
+                    eligible--;                                                               \
+                                                                                              \
+        int needed = mineCount < eligible ? mineCount : eligible;                             \
+        int placed = needed;                                                                  \
+                                                                                              \
+        for (int r = 0; r < (R) && needed > 0; r++)                                           \
+        {                                                                                     \
+            for (int c = 0; c < (C) && needed > 0; c++)                                       \
+            {                                                                                 \
+                if (_isSafeZone(r, c, safe_row, safe_col))                                    \
+                    continue;                                                                 \
+                                                                                              \
+                if ((int)(_nextRandom(rng_state) % (uint64_t)eligible) < needed)              \
+                {                                                                             \
+                    matrix[r][c].data = mine_char;                                            \
+                    needed--;                                                                 \
+                }                                                                             \
+                                                                                              \
+                eligible--;                                                                   \
+            }                                                                                 \
+        }                                                                                     \
+                                                                                              \
+        return placed;                                                                        \
+    }                                                                                         \
+                                                                                              \
+    static void _renderNumbers_##name(Vector2D **matrix)                                      \
+    {                                                                                         \
+        unsigned char mines[(R) + 2][(C) + 2] = {{0}};                                        \
+                                                                                              \
+        for (int r = 0; r < (R); r++)                                                         \
+            for (int c = 0; c < (C); c++)                                                     \
+                mines[r + 1][c + 1] = matrix[r][c].data == mine_char;                         \
+                                                                                              \
+        for (int r = 0; r < (R); r++)                                                         \
+        {                                                                                     \
+            for (int c = 0; c < (C); c++)                                                     \
+            {                                                                                 \
+                if (mines[r + 1][c + 1])                                                      \
+                    continue;                                                                 \
+                                                                                              \
+                int count = mines[r][c] + mines[r][c + 1] + mines[r][c + 2] +                 \
+                            mines[r + 1][c] + mines[r + 1][c + 2] +                           \
+                            mines[r + 2][c] + mines[r + 2][c + 1] + mines[r + 2][c + 2];      \
+                                                                                              \
+                matrix[r][c].data = '0' + count;                                              \
+            }                                                                                 \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    static void _revealRegion_##name(minesweeper_struct *game, int region)                    \
+    {                                                                                         \
+        for (int i = game->region_offsets[region]; i < game->region_offsets[region + 1]; i++) \
+        {                                                                                     \
+            cell_span span = game->region_spans[i];                                           \
+                                                                                              \
+            for (int cell = span.start; cell < span.start + span.len; cell++)                 \
+            {                                                                                 \
+                int r = cell / (C);                                                           \
+                int c = cell % (C);                                                           \
+                                                                                              \
+                if (game->visible_matrix[r][c].data == starting_char)                         \
+                    _setVisible(game, r, c, game->hidden_matrix[r][c].data);                  \
+            }                                                                                 \
+        }                                                                                     \
+    }                                                                                         \
+                                                                                              \
+    static void _revealOpening_##name(minesweeper_struct *game, int row, int col)             \
+    {                                                                                         \
+        int stack[(R) * (C)];                                                                 \
+        int top = 0;                                                                          \
+                                                                                              \
+        _setVisible(game, row, col, '0');                                                     \
+        stack[top++] = row * (C) + col;                                                       \
+                                                                                              \
+        while (top > 0)                                                                       \
+        {                                                                                     \
+            int cell = stack[--top];                                                          \
+            int r = cell / (C);                                                               \
+            int c = cell % (C);                                                               \
+                                                                                              \
+            for (int dr = -1; dr <= 1; dr++)                                                  \
+            {                                                                                 \
+                for (int dc = -1; dc <= 1; dc++)                                              \
+                {                                                                             \
+                    int nr = r + dr;                                                          \
+                    int nc = c + dc;                                                          \
+                                                                                              \
+                    if (nr < 0 || nr >= (R) || nc < 0 || nc >= (C))                           \
+                        continue;                                                             \
+                                                                                              \
+                    if (game->visible_matrix[nr][nc].data != starting_char)                   \
+                        continue;                                                             \
+                                                                                              \
+                    char data = game->hidden_matrix[nr][nc].data;                             \
+                                                                                              \
+                    _setVisible(game, nr, nc, data);                                          \
+                                                                                              \
+                    if (data == '0')                                                          \
+                        stack[top++] = nr * (C) + nc;                                         \
+                }                                                                             \
+            }                                                                                 \
+        }                                                                                     \
+    }
+
+DEFINE_PRESET_ENGINE(beginner, beginner_rows, beginner_cols)
+DEFINE_PRESET_ENGINE(intermediate, intermediate_rows, intermediate_cols)
+DEFINE_PRESET_ENGINE(expert, expert_rows, expert_cols)
+
 // =====================
 //  GAME API
 // =====================
 
 // _renderNumbers(): Calculate and set the number of adjacent mines for each cell
+// Dispatches to a fixed-size variant for the beginner, intermediate and expert presets
 // @param matrix: The matrix representing the board
 // @param rows: Number of rows
 // @param cols: Number of columns
 void _renderNumbers(Vector2D **matrix, int rows, int cols)
 {
+    if (rows == beginner_rows && cols == beginner_cols)
+    {
+        _renderNumbers_beginner(matrix);
+        return;
+    }
+
+    if (rows == intermediate_rows && cols == intermediate_cols)
+    {
+        _renderNumbers_intermediate(matrix);
+        return;
+    }
+
+    if (rows == expert_rows && cols == expert_cols)
+    {
+        _renderNumbers_expert(matrix);
+        return;
+    }
+
     for (int r = 0; r < rows; r++)
     {
         for (int c = 0; c < cols; c++)
@@ -268,209 +443,1467 @@ void _renderNumbers(Vector2D **matrix, int rows, int cols)
 }
 
 // _renderMines(): Randomly place mines in the matrix while avoiding the safe zone
+// Uses selection sampling in raster order: no per-cell buffer, and a file-backed board is written sequentially.
+// Dispatches to a fixed-size variant for the beginner, intermediate and expert presets
 // @param matrix: The matrix representing the board
 // @param rows: Number of rows
 // @param cols: Number of columns
 // @param mineCount: Total number of mines to place
 // @param safe_row: Row of the initial safe move
 // @param safe_col: Column of the initial safe move
-void _renderMines(Vector2D **matrix, int rows, int cols, int mineCount, int safe_row, int safe_col)
+// @param rng_state: Pointer to the game's random stream, advanced in place
+// @return: Number of mines placed, less than mineCount only if the safe zone leaves too few cells
+int _renderMines(Vector2D **matrix, int rows, int cols, int mineCount, int safe_row, int safe_col,
+        uint64_t *rng_state)
 {
-    int total = rows * cols;
+    if (rows == beginner_rows && cols == beginner_cols)
+        return _renderMines_beginner(matrix, mineCount, safe_row, safe_col, rng_state);
+
+    if (rows == intermediate_rows && cols == intermediate_cols)
+        return _renderMines_intermediate(matrix, mineCount, safe_row, safe_col, rng_state);
 
-    int *indices = malloc(total * sizeof(int));
+    if (rows == expert_rows && cols == expert_cols)
+        return _renderMines_expert(matrix, mineCount, safe_row, safe_col, rng_state);
 
-    for (int i = 0; i < total; i++)
-        indices[i] = i;
+    int eligible = rows * cols;
 
-    for (int i = total - 1; i > 0; i--)
+    for (int r = safe_row - 1; r <= safe_row + 1; r++)
     {
-        int j = rand() % (i + 1);
-        int tmp = indices[i];
-        indices[i] = indices[j];
-        indices[j] = tmp;
+        for (int c = safe_col - 1; c <= safe_col + 1; c++)
+        {
+            if (r >= 0 && r < rows && c >= 0 && c < cols)
+                eligible--;
+        }
     }
 
-    int placed = 0;
+    int needed = mineCount < eligible ? mineCount : eligible;
+    int placed = needed;
 
-    for (int k = 0; k < total && placed < mineCount; k++)
+    // Each eligible cell becomes a mine with probability needed / remaining, a uniform placement
+    for (int r = 0; r < rows && needed > 0; r++)
     {
-        int r = indices[k] / cols;
-        int c = indices[k] % cols;
+        for (int c = 0; c < cols && needed > 0; c++)
+        {
+            if (_isSafeZone(r, c, safe_row, safe_col))
+                continue;
 
-        if (_isSafeZone(r, c, safe_row, safe_col))
-            continue;
+            if ((int)(_nextRandom(rng_state) % (uint64_t)eligible) < needed)
+            {
+                matrix[r][c].data = mine_char;
+                needed--;
+            }
 
-        matrix[r][c].data = mine_char;
-        placed++;
+            eligible--;
+        }
     }
 
-    free(indices);
+    return placed;
 }
 
-// _renderMove(): Reveal a cell and recursively reveal adjacent empty cells
-// @param game: Pointer to the game state
-// @param row: Row of the move
-// @param col: Column of the move
-void _renderMove(minesweeper_struct *game, int row, int col)
+// _renderMinesPlane(): Place mines on a mapped hidden plane, drawing the same stream as _renderMines()
+// A seed therefore yields the same board mapped or in memory; cell indices are 64-bit
+// @param plane: The hidden plane, rows * cols bytes
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mineCount: Total number of mines to place
+// @param safe_row: Row of the initial safe move
+// @param safe_col: Column of the initial safe move
+// @param rng_state: Pointer to the game's random stream, advanced in place
+// @return: Number of mines placed, less than mineCount only if the safe zone leaves too few cells
+int _renderMinesPlane(char *plane, int rows, int cols, int mineCount, int safe_row, int safe_col,
+        uint64_t *rng_state)
 {
-    if (row < 0 || row >= game->rows || col < 0 || col >= game->cols)
-        return;
-
-    if (game->visible_matrix[row][col].data != starting_char)
-        return;
+    int64_t eligible = (int64_t)rows * cols;
 
-    if (game->hidden_matrix[row][col].data == mine_char)
+    for (int r = safe_row - 1; r <= safe_row + 1; r++)
     {
-        game->game_over = 1;
-        return;
+        for (int c = safe_col - 1; c <= safe_col + 1; c++)
+        {
+            if (r >= 0 && r < rows && c >= 0 && c < cols)
+                eligible--;
+        }
     }
 
-    if (!game->mines_initialized)
+    int64_t needed = mineCount < eligible ? mineCount : eligible;
+    int placed = (int)needed;
+
+    // Below INT_MAX cells the remainder fits an int, so this draws exactly what _renderMines() does
+    for (int r = 0; r < rows && needed > 0; r++)
     {
-        _renderMines(game->hidden_matrix, game->rows, game->cols, game->mines_amt, row, col);
+        char *line = plane + (uint64_t)r * cols;
+
+        for (int c = 0; c < cols && needed > 0; c++)
+        {
+            if (_isSafeZone(r, c, safe_row, safe_col))
+                continue;
 
-        _renderNumbers(game->hidden_matrix, game->rows, game->cols);
+            if ((int64_t)(_nextRandom(rng_state) % (uint64_t)eligible) < needed)
+            {
+                line[c] = mine_char;
+                needed--;
+            }
 
-        game->mines_initialized = 1;
+            eligible--;
+        }
     }
 
-    game->visible_matrix[row][col].data = game->hidden_matrix[row][col].data;
+    return placed;
+}
 
-    if (game->hidden_matrix[row][col].data == '0')
+// _renderNumbersPlane(): Set the adjacent mine count of every safe cell of a mapped hidden plane
+// Works in place in one sequential pass: only mines are tested, and they are never overwritten
+// @param plane: The hidden plane, rows * cols bytes
+// @param rows: Number of rows
+// @param cols: Number of columns
+void _renderNumbersPlane(char *plane, int rows, int cols)
+{
+    for (int r = 0; r < rows; r++)
     {
-        for (int dr = -1; dr <= 1; dr++)
+        char *above = r > 0 ? plane + (uint64_t)(r - 1) * cols : NULL;
+        char *line = plane + (uint64_t)r * cols;
+        char *below = r + 1 < rows ? plane + (uint64_t)(r + 1) * cols : NULL;
+
+        for (int c = 0; c < cols; c++)
         {
+            if (line[c] == mine_char)
+                continue;
+
+            int count = 0;
+
             for (int dc = -1; dc <= 1; dc++)
             {
-                int nr = row + dr;
-                int nc = col + dc;
-                if (nr >= 0 && nr < game->rows && nc >= 0 && nc < game->cols && !(dr == 0 && dc == 0))
-                    _renderMove(game, nr, nc);
+                int nc = c + dc;
+
+                if (nc < 0 || nc >= cols)
+                    continue;
+
+                count += (above != NULL && above[nc] == mine_char) + (dc != 0 && line[nc] == mine_char) +
+                         (below != NULL && below[nc] == mine_char);
             }
+
+            line[c] = '0' + count;
         }
     }
 }
 
-// _revealBoard(): Reveal all cells on the visible matrix by copying from the hidden matrix
+// _regionRoot(): Find the union-find root of a zero cell, halving the path as it goes
+// @param parent: Parent array indexed by cell
+// @param cell: The cell
+// @return: Index of the root cell
+int _regionRoot(int *parent, int cell)
+{
+    while (parent[cell] != cell)
+    {
+        parent[cell] = parent[parent[cell]];
+        cell = parent[cell];
+    }
+    return cell;
+}
+
+// _regionReserve(): Grow the game's pooled region buffer to at least the given size
 // @param game: Pointer to the game state
-void _revealBoard(minesweeper_struct *game)
+// @param bytes: Required size in bytes
+// @return: Start of the buffer, which may have moved
+char *_regionReserve(minesweeper_struct *game, size_t bytes)
 {
-    for (int r = 0; r < game->rows; r++)
+    if (bytes > game->region_buffer_size)
     {
-        for (int c = 0; c < game->cols; c++)
+        // Offsets are taken before realloc(), since the old pointers are dead once it moves the block
+        int built = game->region_of != NULL;
+        size_t region_of = 0;
+        size_t offsets = 0;
+        size_t spans = 0;
+        size_t flags = 0;
+
+        if (built)
+        {
+            region_of = (char *)game->region_of - game->region_buffer;
+            offsets = (char *)game->region_offsets - game->region_buffer;
+            spans = (char *)game->region_spans - game->region_buffer;
+            flags = (char *)game->region_flags - game->region_buffer;
+        }
+
+        char *grown = realloc(game->region_buffer, bytes);
+
+        assert(grown != NULL);
+
+        game->region_buffer = grown;
+        game->region_buffer_size = bytes;
+
+        if (built)
         {
-            game->visible_matrix[r][c].data = game->hidden_matrix[r][c].data;
+            game->region_of = (int *)(grown + region_of);
+            game->region_offsets = (int *)(grown + offsets);
+            game->region_spans = (cell_span *)(grown + spans);
+            game->region_flags = (int *)(grown + flags);
         }
     }
+
+    return game->region_buffer;
 }
 
-// _toggleFlag(): Place or remove a flag on a cell
+// _cellRegions(): Collect the distinct regions with a zero cell in the 3x3 neighbourhood of a cell
+// @param region_of: Region index of every cell, -1 for non-zero cells
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param r: Row of the cell
+// @param c: Column of the cell
+// @param out: Array of at least 4 entries receiving the regions
+// @return: Number of regions written to out
+int _cellRegions(const int *region_of, int rows, int cols, int r, int c, int *out)
+{
+    int count = 0;
+
+    for (int dr = -1; dr <= 1; dr++)
+    {
+        for (int dc = -1; dc <= 1; dc++)
+        {
+            int nr = r + dr;
+            int nc = c + dc;
+
+            if (nr < 0 || nr >= rows || nc < 0 || nc >= cols)
+                continue;
+
+            int region = region_of[nr * cols + nc];
+
+            if (region == -1)
+                continue;
+
+            int duplicate = 0;
+
+            for (int i = 0; i < count; i++)
+                duplicate |= out[i] == region;
+
+            // A zero centre joins every neighbour into one region, and the 8-cell ring can hold
+            // at most 4 separate zero runs, so out never needs more than 4 entries
+            if (!duplicate)
+                out[count++] = region;
+        }
+    }
+
+    return count;
+}
+
+// _renderRegions(): Label every zero-connected region and store its cells plus numbered border as spans
+// Must run after _renderNumbers(); spans are row-major index ranges, grouped per region.
+// Everything lives in one buffer per game that is reused across rebuilds
 // @param game: Pointer to the game state
-// @param row: Row of the cell
-// @param col: Column of the cell
-void _toggleFlag(minesweeper_struct *game, int row, int col)
+void _renderRegions(minesweeper_struct *game)
 {
-    if (row < 0 || row >= game->rows || col < 0 || col >= game->cols)
-        return;
+    int rows = game->rows;
+    int cols = game->cols;
+    int total = rows * cols;
 
-    char current = game->visible_matrix[row][col].data;
+    int *region_of = (int *)_regionReserve(game, (size_t)total * sizeof(int));
 
-    if (current == starting_char)
+    // Raster pass: union each zero cell with its already-visited zero neighbours (W, NW, N, NE),
+    // using region_of itself as the parent array. Roots always link to the smaller index, so
+    // every parent precedes its child in raster order
+    for (int r = 0; r < rows; r++)
     {
-        game->visible_matrix[row][col].data = flag_char;
+        for (int c = 0; c < cols; c++)
+        {
+            int cell = r * cols + c;
+
+            if (game->hidden_matrix[r][c].data != '0')
+            {
+                region_of[cell] = -1;
+                continue;
+            }
+
+            region_of[cell] = cell;
+
+            const int prior[4][2] = {{0, -1}, {-1, -1}, {-1, 0}, {-1, 1}};
+
+            for (int i = 0; i < 4; i++)
+            {
+                int nr = r + prior[i][0];
+                int nc = c + prior[i][1];
+
+                if (nr < 0 || nc < 0 || nc >= cols || region_of[nr * cols + nc] == -1)
+                    continue;
+
+                int a = _regionRoot(region_of, cell);
+                int b = _regionRoot(region_of, nr * cols + nc);
+
+                if (a < b)
+                    region_of[b] = a;
+                else if (b < a)
+                    region_of[a] = b;
+            }
+        }
     }
-    else if (current == flag_char)
+
+    // Label pass: since parents come first, a cell's parent is already labelled when it is reached.
+    // Labels are stored as -(label + 2) so they cannot be mistaken for parent indices or -1
+    int count = 0;
+
+    for (int cell = 0; cell < total; cell++)
     {
-        game->visible_matrix[row][col].data = starting_char;
+        int parent = region_of[cell];
+
+        if (parent == -1)
+            continue;
+
+        region_of[cell] = (parent == cell) ? -(count++ + 2) : region_of[parent];
     }
-}
 
-// _checkWin(): Check if the player has won the game
-// @param game: Pointer to the game state
-// @return: 1 if all non-mine cells are revealed, 0 otherwise
-int _checkWin(minesweeper_struct *game)
-{
-    for (int r = 0; r < game->rows; r++)
+    size_t ints = (size_t)total + 4 * (size_t)count + 2;
+    char *base = _regionReserve(game, ints * sizeof(int));
+
+    region_of = (int *)base;
+
+    int *offsets = region_of + total;
+    int *flags = offsets + count + 1;
+    int *open_end = flags + count + 1;
+    int *cursor = open_end + count;
+
+    memset(offsets, 0, (count + 1) * sizeof(int));
+    memset(flags, 0, (count + 1) * sizeof(int));
+
+    for (int r = 0; r < rows; r++)
     {
-        for (int c = 0; c < game->cols; c++)
+        for (int c = 0; c < cols; c++)
+        {
+            int cell = r * cols + c;
+
+            region_of[cell] = -region_of[cell] - 2;
+
+            if (region_of[cell] != -1 && game->visible_matrix[r][c].data == flag_char)
+                flags[region_of[cell]]++;
+        }
+    }
+
+    // Span passes: a cell belongs to every region with a zero cell in its 3x3 neighbourhood.
+    // The first pass counts each region's contiguous runs, the second writes them in place
+    for (int i = 0; i < count; i++)
+        open_end[i] = -1;
+
+    for (int r = 0; r < rows; r++)
+    {
+        for (int c = 0; c < cols; c++)
         {
-            if (game->visible_matrix[r][c].data == starting_char &&
-                    game->hidden_matrix[r][c].data != mine_char)
+            int regions[4];
+            int n = _cellRegions(region_of, rows, cols, r, c, regions);
+
+            for (int i = 0; i < n; i++)
             {
-                return 0;
+                if (open_end[regions[i]] != r * cols + c)
+                    offsets[regions[i] + 1]++;
+
+                open_end[regions[i]] = r * cols + c + 1;
             }
         }
     }
-    return 1;
+
+    for (int region = 0; region < count; region++)
+    {
+        offsets[region + 1] += offsets[region];
+        cursor[region] = offsets[region];
+        open_end[region] = -1;
+    }
+
+    size_t span_at = ints * sizeof(int);
+
+    span_at = (span_at + sizeof(cell_span) - 1) / sizeof(cell_span) * sizeof(cell_span);
+
+    base = _regionReserve(game, span_at + (size_t)offsets[count] * sizeof(cell_span));
+
+    region_of = (int *)base;
+    offsets = region_of + total;
+    flags = offsets + count + 1;
+    open_end = flags + count + 1;
+    cursor = open_end + count;
+
+    cell_span *spans = (cell_span *)(base + span_at);
+
+    for (int r = 0; r < rows; r++)
+    {
+        for (int c = 0; c < cols; c++)
+        {
+            int cell = r * cols + c;
+            int regions[4];
+            int n = _cellRegions(region_of, rows, cols, r, c, regions);
+
+            for (int i = 0; i < n; i++)
+            {
+                int region = regions[i];
+
+                if (open_end[region] == cell)
+                {
+                    spans[cursor[region] - 1].len++;
+                }
+                else
+                {
+                    spans[cursor[region]].start = cell;
+                    spans[cursor[region]].len = 1;
+                    cursor[region]++;
+                }
+
+                open_end[region] = cell + 1;
+            }
+        }
+    }
+
+    game->region_of = region_of;
+    game->region_offsets = offsets;
+    game->region_spans = spans;
+    game->region_flags = flags;
+    game->region_count = count;
+    game->region_used = span_at + (size_t)offsets[count] * sizeof(cell_span);
 }
 
-// _parseAndValidateMove(): Parses user input and validates coordinates
-// @param move_str: String containing the user's move input
-// @param game: Pointer to the minesweeper game struct
-// @param coords: Pointer to coordinate struct to store parsed coordinates
-// @param is_flag: Pointer to int that will be set to 1 if move is a flag command
-// @return: 1 if coordinates are valid, 0 if invalid
-int _parseAndValidateMove(char *move_str, minesweeper_struct *game,
-        input_coordinate *coords, int *is_flag)
+// _clearRegions(): Invalidate the region index of a game, keeping its buffer for the next build
+// @param game: Pointer to the game state
+void _clearRegions(minesweeper_struct *game)
 {
-    size_t len = strlen(move_str);
-    *is_flag = 0;
+    game->region_of = NULL;
+    game->region_offsets = NULL;
+    game->region_spans = NULL;
+    game->region_flags = NULL;
+    game->region_count = 0;
+    game->region_used = 0;
+}
 
-    if (len > 1 && move_str[len - 1] == flag_char)
+// _revealRegion(): Reveal every unrevealed cell of a region by walking its spans
+// Dispatches to a fixed-size variant for the beginner, intermediate and expert presets
+// @param game: Pointer to the game state
+// @param region: Index of the region
+void _revealRegion(minesweeper_struct *game, int region)
+{
+    if (game->rows == beginner_rows && game->cols == beginner_cols)
     {
-        move_str[len - 1] = '\0';
-        *is_flag = 1;
+        _revealRegion_beginner(game, region);
+        return;
+    }
+
+    if (game->rows == intermediate_rows && game->cols == intermediate_cols)
+    {
+        _revealRegion_intermediate(game, region);
+        return;
+    }
+
+    if (game->rows == expert_rows && game->cols == expert_cols)
+    {
+        _revealRegion_expert(game, region);
+        return;
+    }
+
+    int cols = game->cols;
+
+    for (int i = game->region_offsets[region]; i < game->region_offsets[region + 1]; i++)
+    {
+        cell_span span = game->region_spans[i];
+
+        for (int cell = span.start; cell < span.start + span.len; cell++)
+        {
+            int r = cell / cols;
+            int c = cell % cols;
+
+            if (game->visible_matrix[r][c].data == starting_char)
+                _setVisible(game, r, c, game->hidden_matrix[r][c].data);
+        }
     }
+}
+
+// _floodReveal(): Reveal a zero cell and the opening around it with an explicit queue
+// Cells are revealed as they are queued, so each zero cell is queued once, and the breadth-first order
+// keeps only the opening's frontier queued. The queue is a ring in the pooled region buffer after
+// the region index, so deep openings never grow the call stack
+// @param game: Pointer to the game state
+// @param row: Row of the zero cell
+// @param col: Column of the zero cell
+void _floodReveal(minesweeper_struct *game, int row, int col)
+{
+    int rows = game->rows;
+    int cols = game->cols;
+
+    size_t queue_at = (game->region_used + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+    size_t capacity = 64;
+
+    // Reuse whatever the buffer already holds; the capacity stays a power of two for the ring mask
+    while (queue_at + capacity * 2 * sizeof(uint64_t) <= game->region_buffer_size)
+        capacity *= 2;
+
+    uint64_t *queue = (uint64_t *)(_regionReserve(game, queue_at + capacity * sizeof(uint64_t)) + queue_at);
+    size_t head = 0;
+    size_t count = 0;
+
+    _setVisible(game, row, col, '0');
+    queue[count++] = (uint64_t)row * cols + col;
+
+    while (count > 0)
+    {
+        uint64_t cell = queue[head];
+        int r = (int)(cell / cols);
+        int c = (int)(cell % cols);
+
+        head = (head + 1) & (capacity - 1);
+        count--;
+
+        for (int dr = -1; dr <= 1; dr++)
+        {
+            for (int dc = -1; dc <= 1; dc++)
+            {
+                int nr = r + dr;
+                int nc = c + dc;
+
+                if (nr < 0 || nr >= rows || nc < 0 || nc >= cols)
+                    continue;
+
+                if (_visibleAt(game, nr, nc) != starting_char)
+                    continue;
+
+                char data = _hiddenAt(game, nr, nc);
+
+                _setVisible(game, nr, nc, data);
+
+                if (data != '0')
+                    continue;
+
+                // A full ring wraps at head; moving the wrapped part past the old end unrolls it
+                if (count == capacity)
+                {
+                    queue = (uint64_t *)(_regionReserve(game, queue_at + capacity * 2 * sizeof(uint64_t)) + queue_at);
+                    memcpy(queue + capacity, queue, head * sizeof(uint64_t));
+                    capacity *= 2;
+                }
+
+                queue[(head + count++) & (capacity - 1)] = (uint64_t)nr * cols + nc;
+            }
+        }
+    }
+}
+
+// _renderMove(): Reveal a cell and every cell of the opening it belongs to
+// In-memory games reveal unflagged openings from the region index; mapped games never build the
+// index, which would scan the whole board, and flood from the clicked cell instead
+// @param game: Pointer to the game state
+// @param row: Row of the move
+// @param col: Column of the move
+void _renderMove(minesweeper_struct *game, int row, int col)
+{
+    if (row < 0 || row >= game->rows || col < 0 || col >= game->cols)
+        return;
+
+    if (_visibleAt(game, row, col) != starting_char)
+        return;
+
+    if (_hiddenAt(game, row, col) == mine_char)
+    {
+        game->game_over = 1;
+        return;
+    }
+
+    if (!game->mines_initialized)
+    {
+        int64_t cells = (int64_t)game->rows * game->cols;
+
+        if (game->hidden_plane != NULL)
+        {
+#ifndef _WIN32
+            madvise(game->hidden_plane, (size_t)cells, MADV_SEQUENTIAL);
+#endif
+
+            game->safe_total = cells - _renderMinesPlane(game->hidden_plane, game->rows, game->cols,
+                    game->mines_amt, row, col, &game->rng_state);
+
+            _renderNumbersPlane(game->hidden_plane, game->rows, game->cols);
+
+#ifndef _WIN32
+            madvise(game->hidden_plane, (size_t)cells, MADV_NORMAL);
+#endif
+        }
+        else
+        {
+            game->safe_total = cells - _renderMines(game->hidden_matrix, game->rows, game->cols,
+                    game->mines_amt, row, col, &game->rng_state);
+
+            _renderNumbers(game->hidden_matrix, game->rows, game->cols);
+        }
+
+        game->mines_initialized = 1;
+    }
+
+    char data = _hiddenAt(game, row, col);
+
+    if (data != '0')
+    {
+        _setVisible(game, row, col, data);
+        return;
+    }
+
+    if (game->hidden_plane == NULL)
+    {
+        // The index is built on the first opening, so games that never reveal a zero skip it
+        if (game->region_of == NULL)
+            _renderRegions(game);
+
+        // A flag on one of the region's zero cells can cut the opening short, so only
+        // unflagged regions take the span path; flagged ones fall back to a search
+        int region = game->region_of[row * game->cols + col];
+
+        if (game->region_flags[region] == 0)
+        {
+            _revealRegion(game, region);
+            return;
+        }
+
+        if (game->rows == beginner_rows && game->cols == beginner_cols)
+        {
+            _revealOpening_beginner(game, row, col);
+            return;
+        }
+
+        if (game->rows == intermediate_rows && game->cols == intermediate_cols)
+        {
+            _revealOpening_intermediate(game, row, col);
+            return;
+        }
+
+        if (game->rows == expert_rows && game->cols == expert_cols)
+        {
+            _revealOpening_expert(game, row, col);
+            return;
+        }
+    }
+
+    _floodReveal(game, row, col);
+}
+
+// _revealBoard(): Reveal all cells on the visible matrix by copying from the hidden matrix
+// Journaled as its own step, so one undo takes back the reveal and the next the move before it
+// @param game: Pointer to the game state
+void _revealBoard(minesweeper_struct *game)
+{
+    size_t start = _journalBeginMove(game);
+
+    for (int r = 0; r < game->rows; r++)
+    {
+        for (int c = 0; c < game->cols; c++)
+        {
+            char data = _hiddenAt(game, r, c);
+
+            if (_visibleAt(game, r, c) != data)
+                _setVisible(game, r, c, data);
+        }
+    }
+
+    _journalEndMove(game, start);
+}
+
+// _toggleFlag(): Place or remove a flag on a cell
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+void _toggleFlag(minesweeper_struct *game, int row, int col)
+{
+    if (row < 0 || row >= game->rows || col < 0 || col >= game->cols)
+        return;
+
+    char current = _visibleAt(game, row, col);
+
+    if (current == starting_char)
+    {
+        _setVisible(game, row, col, flag_char);
+    }
+    else if (current == flag_char)
+    {
+        _setVisible(game, row, col, starting_char);
+    }
+}
+
+// _chordMove(): Reveal every unflagged neighbour of a number whose flag count matches it
+// @param game: Pointer to the game state
+// @param row: Row of the numbered cell
+// @param col: Column of the numbered cell
+// @return: 1 if the chord was applied, 0 if the cell is not a satisfied number
+int _chordMove(minesweeper_struct *game, int row, int col)
+{
+    if (row < 0 || row >= game->rows || col < 0 || col >= game->cols)
+        return 0;
+
+    char current = _visibleAt(game, row, col);
+
+    if (current < '1' || current > '8')
+        return 0;
+
+    int flags = 0;
+
+    for (int dr = -1; dr <= 1; dr++)
+    {
+        for (int dc = -1; dc <= 1; dc++)
+        {
+            int nr = row + dr;
+            int nc = col + dc;
+            if (nr >= 0 && nr < game->rows && nc >= 0 && nc < game->cols &&
+                    _visibleAt(game, nr, nc) == flag_char)
+                flags++;
+        }
+    }
+
+    if (flags != current - '0')
+        return 0;
+
+    for (int dr = -1; dr <= 1; dr++)
+    {
+        for (int dc = -1; dc <= 1; dc++)
+        {
+            if (!(dr == 0 && dc == 0))
+                _renderMove(game, row + dr, col + dc);
+        }
+    }
+
+    return 1;
+}
+
+// _checkWin(): Check if the player has won the game
+// Reads the revealed-cell counter kept by _writeVisible(), so it never scans the board
+// @param game: Pointer to the game state
+// @return: 1 if all non-mine cells are revealed, 0 otherwise
+int _checkWin(minesweeper_struct *game)
+{
+    return game->mines_initialized && game->revealed_safe == game->safe_total;
+}
+
+// _parseAndValidateMove(): Parses user input and validates coordinates
+// @param move_str: String containing the user's move input
+// @param game: Pointer to the minesweeper game struct
+// @param coords: Pointer to coordinate struct to store parsed coordinates
+// @param is_flag: Pointer to int that will be set to 1 if move is a flag command
+// @return: 1 if coordinates are valid, 0 if invalid
+int _parseAndValidateMove(char *move_str, minesweeper_struct *game,
+        input_coordinate *coords, int *is_flag)
+{
+    size_t len = strlen(move_str);
+    *is_flag = 0;
+
+    if (len > 1 && move_str[len - 1] == flag_char)
+    {
+        move_str[len - 1] = '\0';
+        *is_flag = 1;
+    }
+
+    _parseMove(move_str, &coords->row, &coords->col);
+
+    if (*is_flag)
+        move_str[len - 1] = flag_char;
+
+    return !(coords->row == -1 || coords->col == -1 ||
+            coords->row >= game->rows || coords->col >= game->cols);
+}
+
+// _displayGame(): Clears screen and displays the current game board
+// @param game: Pointer to the minesweeper game struct
+void _displayGame(minesweeper_struct *game)
+{
+    _clearScreen();
+
+    _printMatrixData(game->visible_matrix, game->rows, game->cols);
+}
+
+// _showHelp(): Displays the help menu with available commands
+void _showHelp(void)
+{
+    printf("\n--- COMMANDS ---\n\n"
+            "- Playing moves: <Character><Integer>. Characters are on the X-Axis and Integers on Y-Axis. (e.g. A1, B2)\n\n"
+            "- Flagging: <Character><Integer>%c. Flags/unflags a cell. (e.g. C4%c, G10%c)\n\n"
+            "- Undoing: --UNDO. Takes back the last move or flag\n\n"
+            "- Getting Seed: --SEED\n\n"
+            "- Quitting: --quit\n",
+            flag_char, flag_char, flag_char);
+
+    _waitForEnter();
+}
+
+// _showSeed(): Display the current seed
+// @param game: Pointer to the minesweeper game struct
+void _showSeed(minesweeper_struct *game)
+{
+    printf("\nSEED: %d\n", game->current_seed);
+
+    _waitForEnter();
+}
+
+// _showGameEnd(): Reveals the board and displays win/loss message
+// @param game: Pointer to the minesweeper game struct
+// @param won: 1 if player won, 0 if player lost
+void _showGameEnd(minesweeper_struct *game, int won)
+{
+    _revealBoard(game);
+    _displayGame(game);
+    printf(won ? "\n--- YOU WIN! ---\n" : "\n--- BOMB HIT. GAME OVER. ---\n");
+}
+
+// =====================
+//  UNDO API
+// =====================
+
+// _journalPush(): Append an entry to the undo journal, growing it if needed
+// @param game: Pointer to the game state
+// @return: Pointer to the new, uninitialized entry
+journal_entry *_journalPush(minesweeper_struct *game)
+{
+    if (game->journal_len == game->journal_cap)
+    {
+        size_t cap = game->journal_cap ? game->journal_cap * 2 : 64;
+        journal_entry *grown = realloc(game->journal, cap * sizeof(journal_entry));
+
+        assert(grown != NULL);
+
+        game->journal = grown;
+        game->journal_cap = cap;
+    }
+
+    return &game->journal[game->journal_len++];
+}
+
+// _journalBeginMove(): Open an undoable step by pushing a move marker that saves game_over
+// @param game: Pointer to the game state
+// @return: Journal length just after the marker, to pass to _journalEndMove()
+size_t _journalBeginMove(minesweeper_struct *game)
+{
+    journal_entry *marker = _journalPush(game);
+
+    marker->kind = journal_move;
+    marker->game_over = (char)game->game_over;
+
+    return game->journal_len;
+}
+
+// _journalEndMove(): Close an undoable step, dropping its marker if the step changed nothing
+// @param game: Pointer to the game state
+// @param start: The value returned by _journalBeginMove()
+void _journalEndMove(minesweeper_struct *game, size_t start)
+{
+    // Hitting a mine changes game_over without touching a cell, so that still counts as a step
+    if (game->journal_len == start && game->journal[start - 1].game_over == game->game_over)
+        game->journal_len--;
+}
+
+// _writeVisible(): Set a cell on the visible board and update the Zobrist hash, without journaling
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @param value: Character to set as the cell's data
+void _writeVisible(minesweeper_struct *game, int row, int col, char value)
+{
+    uint64_t cell = (uint64_t)row * game->cols + col;
+    char current = _visibleAt(game, row, col);
+
+    game->hash ^= _zobristKey(cell, current) ^ _zobristKey(cell, value);
+
+    // Digits only ever appear on safe cells, so they double as the revealed-safe-cell count
+    game->revealed_safe += (value >= '0' && value <= '8') - (current >= '0' && current <= '8');
+
+    if (game->region_of != NULL && game->region_of[cell] != -1)
+        game->region_flags[game->region_of[cell]] += (value == flag_char) - (current == flag_char);
+
+    // The mapped plane stores starting_char as 0, so hiding a cell again leaves the file sparse
+    if (game->visible_plane != NULL)
+        game->visible_plane[cell] = value == starting_char ? 0 : value;
+    else
+        game->visible_matrix[row][col].data = value;
+
+    _emitEvent(game, row, col, value);
+}
+
+// _setVisible(): Set a cell on the visible matrix and record its previous value in the journal
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @param value: Character to set as the cell's data
+void _setVisible(minesweeper_struct *game, int row, int col, char value)
+{
+    journal_entry *entry = _journalPush(game);
+
+    entry->row = row;
+    entry->col = col;
+    entry->prev = _visibleAt(game, row, col);
+    entry->kind = journal_cell;
+
+    _writeVisible(game, row, col, value);
+}
+
+// minesweeper_make(): Apply a move as a single undoable step
+// @param game: Pointer to the game state
+// @param row: Row of the move
+// @param col: Column of the move
+// @param is_flag: 1 to toggle a flag, 0 to reveal
+void minesweeper_make(minesweeper_struct *game, int row, int col, int is_flag)
+{
+    size_t start = _journalBeginMove(game);
+
+    if (is_flag)
+        _toggleFlag(game, row, col);
+    else
+        _renderMove(game, row, col);
+
+    _journalEndMove(game, start);
+}
+
+// minesweeper_apply_batch(): Apply reveals, flags and chords in one pass as a single undoable step
+// Win and loss are evaluated once, after the last move
+// @param game: Pointer to the game state
+// @param moves: Array of moves; type is move_reveal, move_flag or move_chord
+// @param count: Number of moves
+// @param results: Optional array of count entries receiving move_applied, move_unchanged,
+//                 move_invalid, move_exploded, or move_skipped for moves after a mine was hit
+// @return: 1 if the game is won, -1 if it is lost, 0 if it continues
+int minesweeper_apply_batch(minesweeper_struct *game, const batch_move *moves, int count, int *results)
+{
+    size_t start = _journalBeginMove(game);
+
+    for (int i = 0; i < count; i++)
+    {
+        const batch_move *move = &moves[i];
+        int result;
+
+        if (game->game_over)
+        {
+            result = move_skipped;
+        }
+        else if (move->row < 0 || move->row >= game->rows || move->col < 0 || move->col >= game->cols)
+        {
+            result = move_invalid;
+        }
+        else
+        {
+            // Every visible change is journaled, so a grown journal means the move did something
+            size_t before = game->journal_len;
+            int known = 1;
+
+            switch (move->type)
+            {
+            case move_reveal:
+                _renderMove(game, move->row, move->col);
+                break;
+            case move_flag:
+                _toggleFlag(game, move->row, move->col);
+                break;
+            case move_chord:
+                _chordMove(game, move->row, move->col);
+                break;
+            default:
+                known = 0;
+                break;
+            }
+
+            if (!known)
+                result = move_invalid;
+            else if (game->game_over)
+                result = move_exploded;
+            else
+                result = game->journal_len > before ? move_applied : move_unchanged;
+        }
+
+        if (results != NULL)
+            results[i] = result;
+    }
+
+    _journalEndMove(game, start);
+
+    if (game->game_over)
+        return -1;
+
+    return _checkWin(game);
+}
+
+// minesweeper_unmake(): Roll back the last move made with minesweeper_make() or minesweeper_apply_batch()
+// @param game: Pointer to the game state
+// @return: 1 if a move was undone, 0 if the journal is empty
+int minesweeper_unmake(minesweeper_struct *game)
+{
+    if (game->journal_len == 0)
+        return 0;
+
+    while (game->journal_len > 0)
+    {
+        journal_entry *entry = &game->journal[--game->journal_len];
+
+        if (entry->kind == journal_move)
+        {
+            game->game_over = entry->game_over;
+            break;
+        }
+
+        _writeVisible(game, entry->row, entry->col, entry->prev);
+    }
+
+    return 1;
+}
+
+// =====================
+//  EVENT API
+// =====================
+
+// _emitEvent(): Deliver a cell change to the attached ring buffer and callback, if any
+// @param game: Pointer to the game state
+// @param row: Row of the changed cell
+// @param col: Column of the changed cell
+// @param data: The cell's new visible character
+void _emitEvent(minesweeper_struct *game, int row, int col, char data)
+{
+    if (game->event_ring == NULL && game->event_callback == NULL)
+        return;
+
+    cell_event event = {row, col, data};
+
+    if (game->event_ring != NULL)
+        cell_event_ring_push(game->event_ring, &event);
+
+    if (game->event_callback != NULL)
+        game->event_callback(&event, game->event_userdata);
+}
+
+// cell_event_ring_init(): Allocate a single-producer, single-consumer ring of cell events
+// @param capacity: Number of events, rounded up to a power of two
+// @return: Pointer to the allocated ring
+cell_event_ring *cell_event_ring_init(size_t capacity)
+{
+    size_t size = 1;
+
+    while (size < capacity)
+        size <<= 1;
+
+    cell_event_ring *ring = malloc(sizeof(cell_event_ring));
+
+    assert(ring != NULL);
+
+    ring->events = malloc(size * sizeof(cell_event));
+
+    assert(ring->events != NULL);
+
+    ring->mask = size - 1;
+
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+
+    return ring;
+}
+
+// cell_event_ring_push(): Append an event, counting it as dropped if the ring is full
+// @param ring: The ring
+// @param event: The event to append
+// @return: 1 if stored, 0 if dropped
+int cell_event_ring_push(cell_event_ring *ring, const cell_event *event)
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    if (head - tail > ring->mask)
+    {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return 0;
+    }
+
+    ring->events[head & ring->mask] = *event;
+
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+    return 1;
+}
+
+// cell_event_ring_pop(): Take the oldest event from the ring
+// @param ring: The ring
+// @param event: Pointer to store the event
+// @return: 1 if an event was taken, 0 if the ring is empty
+int cell_event_ring_pop(cell_event_ring *ring, cell_event *event)
+{
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    if (tail == head)
+        return 0;
+
+    *event = ring->events[tail & ring->mask];
+
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+
+    return 1;
+}
+
+// cell_event_ring_destroy(): Free a ring of cell events
+// @param ring: The ring
+void cell_event_ring_destroy(cell_event_ring *ring)
+{
+    assert(ring != NULL);
+
+    free(ring->events);
+    free(ring);
+}
+
+// minesweeper_set_event_ring(): Attach a ring that receives every visible cell change
+// @param game: Pointer to the game state
+// @param ring: The ring, or NULL to detach
+void minesweeper_set_event_ring(minesweeper_struct *game, cell_event_ring *ring)
+{
+    game->event_ring = ring;
+}
+
+// minesweeper_set_event_callback(): Attach a callback invoked for every visible cell change
+// @param game: Pointer to the game state
+// @param callback: The callback, or NULL to detach
+// @param userdata: Pointer passed through to the callback
+void minesweeper_set_event_callback(minesweeper_struct *game, cell_event_callback callback, void *userdata)
+{
+    game->event_callback = callback;
+
+    game->event_userdata = userdata;
+}
+
+// =====================
+//  HASHING API
+// =====================
+
+// _splitMix64(): Mix a 64-bit value into a well distributed 64-bit hash
+// @param x: The value to mix
+// @return: The mixed value
+uint64_t _splitMix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// _nextRandom(): Draw the next value from a per-game random stream
+// Games own their stream, so boards from different threads never share state
+// @param state: Pointer to the stream state, advanced in place
+// @return: A uniformly distributed 64-bit value
+uint64_t _nextRandom(uint64_t *state)
+{
+    return _splitMix64((*state)++);
+}
+
+// _zobristKey(): Get the Zobrist key for a cell showing the given character
+// @param cell: Row-major index of the cell
+// @param data: The visible character of the cell
+// @return: The 64-bit key, identical across games and processes
+uint64_t _zobristKey(uint64_t cell, char data)
+{
+    if (data == starting_char)
+        return 0;
+
+    return _splitMix64((cell << 8) | (unsigned char)data);
+}
+
+// _zobristEmpty(): Get the Zobrist hash of a board whose cells are all still hidden
+// Dimensions and mine count are mixed in, so equal-looking positions from different densities differ
+// @param game: Pointer to the game state
+// @return: The 64-bit hash
+uint64_t _zobristEmpty(const minesweeper_struct *game)
+{
+    return _splitMix64(((uint64_t)game->rows << 32) | (uint32_t)game->cols) ^
+           _splitMix64(~(uint64_t)(uint32_t)game->mines_amt);
+}
+
+// _zobristBoard(): Compute the Zobrist hash of the whole visible board from scratch
+// @param game: Pointer to the game state
+// @return: The 64-bit hash
+uint64_t _zobristBoard(minesweeper_struct *game)
+{
+    uint64_t hash = _zobristEmpty(game);
+
+    for (int r = 0; r < game->rows; r++)
+    {
+        for (int c = 0; c < game->cols; c++)
+        {
+            hash ^= _zobristKey((uint64_t)r * game->cols + c, _visibleAt(game, r, c));
+        }
+    }
+
+    return hash;
+}
+
+// transposition_table_init(): Allocate a lock-free transposition table
+// @param size: Number of entries, rounded up to a power of two
+// @return: Pointer to the allocated table
+transposition_table *transposition_table_init(size_t size)
+{
+    size_t capacity = 1;
+
+    while (capacity < size)
+        capacity <<= 1;
+
+    transposition_table *table = malloc(sizeof(transposition_table));
+
+    assert(table != NULL);
+
+    table->entries = malloc(capacity * sizeof(transposition_entry));
+
+    assert(table->entries != NULL);
+
+    for (size_t i = 0; i < capacity; i++)
+    {
+        atomic_init(&table->entries[i].key, 0);
+        atomic_init(&table->entries[i].data, 0);
+    }
+
+    table->mask = capacity - 1;
+
+    return table;
+}
+
+// transposition_table_store(): Store a value for a position, replacing whatever shared its slot
+// Hash 0 is reserved to mark empty slots, so a position hashing to 0 is never stored
+// @param table: The table
+// @param hash: Zobrist hash of the position
+// @param data: The value to store
+void transposition_table_store(transposition_table *table, uint64_t hash, uint64_t data)
+{
+    if (hash == 0)
+        return;
+
+    transposition_entry *entry = &table->entries[hash & table->mask];
+
+    // Key is stored XORed with data so a probe racing a store sees a mismatch instead of a torn hit
+    atomic_store_explicit(&entry->key, hash ^ data, memory_order_relaxed);
+    atomic_store_explicit(&entry->data, data, memory_order_relaxed);
+}
+
+// transposition_table_probe(): Look up the value stored for a position
+// @param table: The table
+// @param hash: Zobrist hash of the position
+// @param data: Pointer to store the value on a hit
+// @return: 1 on a hit, 0 on a miss, a torn entry, or the reserved hash 0
+int transposition_table_probe(transposition_table *table, uint64_t hash, uint64_t *data)
+{
+    // A zeroed slot decodes as hash 0 with data 0, so hash 0 would otherwise hit on every empty slot
+    if (hash == 0)
+        return 0;
+
+    transposition_entry *entry = &table->entries[hash & table->mask];
+
+    uint64_t key = atomic_load_explicit(&entry->key, memory_order_relaxed);
+    uint64_t value = atomic_load_explicit(&entry->data, memory_order_relaxed);
+
+    if ((key ^ value) != hash)
+        return 0;
+
+    *data = value;
+
+    return 1;
+}
+
+// transposition_table_destroy(): Free a transposition table
+// @param table: The table
+void transposition_table_destroy(transposition_table *table)
+{
+    assert(table != NULL);
+
+    free(table->entries);
+    free(table);
+}
+
+// =====================
+//  BATCH API
+// =====================
+
+// minesweeper_batch_init(): Allocate storage for generating many boards of the same size at once
+// @param seed: The random seed; each lane derives its own stream from it
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mines_amt: The amount of mines to place on every board
+// @param lanes: Number of boards generated per call
+// @return: Pointer to the allocated batch
+minesweeper_batch *minesweeper_batch_init(int seed, int rows, int cols, int mines_amt, int lanes)
+{
+    assert(lanes > 0);
+    assert(mines_amt < rows * cols);
+
+    minesweeper_batch *batch = malloc(sizeof(minesweeper_batch));
+
+    assert(batch != NULL);
+
+    size_t total = (size_t)rows * cols * lanes;
+
+    batch->cells = malloc(total);
+    batch->mines = malloc(total);
+    batch->needed = malloc(lanes * sizeof(uint32_t));
+    batch->rng_state = malloc(lanes * sizeof(uint64_t));
+
+    assert(batch->cells && batch->mines && batch->needed && batch->rng_state);
+
+    for (int k = 0; k < lanes; k++)
+    {
+        // xorshift must never be seeded with zero
+        batch->rng_state[k] = _splitMix64(((uint64_t)(uint32_t)seed << 32) | (uint32_t)k) | 1;
+    }
+
+    batch->rows = rows;
+    batch->cols = cols;
+    batch->mines_amt = mines_amt;
+    batch->lanes = lanes;
+    batch->safe_row = -1;
+    batch->safe_col = -1;
+
+    return batch;
+}
+
+// minesweeper_batch_generate(): Place mines and numbers on every lane of the batch
+// The lane loops are marked for SIMD, so they vectorise at -O2 when built with -fopenmp-simd
+// @param batch: Pointer to the batch
+// @param safe_row: Row of the initial safe move shared by all lanes
+// @param safe_col: Column of the initial safe move shared by all lanes
+void minesweeper_batch_generate(minesweeper_batch *batch, int safe_row, int safe_col)
+{
+    int rows = batch->rows;
+    int cols = batch->cols;
+    int lanes = batch->lanes;
+
+    unsigned char *restrict mines = batch->mines;
+    char *restrict cells = batch->cells;
+    uint32_t *restrict needed = batch->needed;
+    uint64_t *restrict state = batch->rng_state;
+
+    int eligible = 0;
+
+    for (int r = 0; r < rows; r++)
+    {
+        for (int c = 0; c < cols; c++)
+        {
+            if (!_isSafeZone(r, c, safe_row, safe_col))
+                eligible++;
+        }
+    }
+
+    assert(batch->mines_amt <= eligible);
+
+    batch->safe_row = safe_row;
+    batch->safe_col = safe_col;
+
+#pragma omp simd
+    for (int k = 0; k < lanes; k++)
+        needed[k] = batch->mines_amt;
+
+    // Selection sampling: each eligible cell becomes a mine with probability needed / remaining,
+    // which yields a uniform placement without a per-lane shuffle
+    uint32_t remaining = eligible;
+
+    for (int r = 0; r < rows; r++)
+    {
+        for (int c = 0; c < cols; c++)
+        {
+            unsigned char *lane_mines = mines + (size_t)(r * cols + c) * lanes;
+
+            if (_isSafeZone(r, c, safe_row, safe_col))
+            {
+                memset(lane_mines, 0, lanes);
+                continue;
+            }
+
+#pragma omp simd
+            for (int k = 0; k < lanes; k++)
+            {
+                uint64_t x = state[k];
+                x ^= x << 13;
+                x ^= x >> 7;
+                x ^= x << 17;
+                state[k] = x;
+
+                uint32_t pick = (uint32_t)(((x >> 32) * remaining) >> 32);
+                unsigned char is_mine = pick < needed[k];
+
+                lane_mines[k] = is_mine;
+                needed[k] -= is_mine;
+            }
+
+            remaining--;
+        }
+    }
+
+    for (int r = 0; r < rows; r++)
+    {
+        for (int c = 0; c < cols; c++)
+        {
+            char *lane_cells = cells + (size_t)(r * cols + c) * lanes;
+            const unsigned char *lane_mines = mines + (size_t)(r * cols + c) * lanes;
+
+#pragma omp simd
+            for (int k = 0; k < lanes; k++)
+                lane_cells[k] = 0;
+
+            for (int dr = -1; dr <= 1; dr++)
+            {
+                for (int dc = -1; dc <= 1; dc++)
+                {
+                    int nr = r + dr;
+                    int nc = c + dc;
 
-    _parseMove(move_str, &coords->row, &coords->col);
+                    if ((dr == 0 && dc == 0) || nr < 0 || nr >= rows || nc < 0 || nc >= cols)
+                        continue;
 
-    if (*is_flag)
-        move_str[len - 1] = flag_char;
+                    const unsigned char *neighbour = mines + (size_t)(nr * cols + nc) * lanes;
 
-    return !(coords->row == -1 || coords->col == -1 ||
-            coords->row >= game->rows || coords->col >= game->cols);
+#pragma omp simd
+                    for (int k = 0; k < lanes; k++)
+                        lane_cells[k] += neighbour[k];
+                }
+            }
+
+#pragma omp simd
+            for (int k = 0; k < lanes; k++)
+                lane_cells[k] = lane_mines[k] ? mine_char : '0' + lane_cells[k];
+        }
+    }
 }
 
-// _displayGame(): Clears screen and displays the current game board
-// @param game: Pointer to the minesweeper game struct
-void _displayGame(minesweeper_struct *game)
+// minesweeper_batch_load(): Reset a game to a fresh start on one generated lane
+// The visible matrix, undo journal and game_over are cleared, so a game can be reused across lanes.
+// The first reveal must be at (batch->safe_row, batch->safe_col), the cell the batch was generated for
+// @param batch: Pointer to a generated batch
+// @param lane: Index of the board to copy
+// @param game: Pointer to a game with the same dimensions
+void minesweeper_batch_load(minesweeper_batch *batch, int lane, minesweeper_struct *game)
 {
-    _clearScreen();
+    assert(lane >= 0 && lane < batch->lanes);
+    assert(batch->safe_row >= 0);
+    assert(game->mapped_base == NULL);
+    assert(game->rows == batch->rows && game->cols == batch->cols);
 
-    _printMatrixData(game->visible_matrix, game->rows, game->cols);
-}
+    _clearRegions(game);
 
-// _showHelp(): Displays the help menu with available commands
-void _showHelp(void)
-{
-    printf("\n--- COMMANDS ---\n\n"
-            "- Playing moves: <Character><Integer>. Characters are on the X-Axis and Integers on Y-Axis. (e.g. A1, B2)\n\n"
-            "- Flagging: <Character><Integer>%c. Flags/unflags a cell. (e.g. C4%c, G10%c)\n\n"
-            "- Getting Seed: --SEED\n\n"
-            "- Quitting: --quit\n",
-            flag_char, flag_char, flag_char);
+    // Clearing through _writeVisible keeps the hash and revealed-cell count in step and tells listeners
+    for (int r = 0; r < game->rows; r++)
+    {
+        for (int c = 0; c < game->cols; c++)
+        {
+            if (game->visible_matrix[r][c].data != starting_char)
+                _writeVisible(game, r, c, starting_char);
 
-    _waitForEnter();
-}
+            game->hidden_matrix[r][c].data = batch->cells[(size_t)(r * game->cols + c) * batch->lanes + lane];
+        }
+    }
 
-// _showSeed(): Display the current seed
-// @param game: Pointer to the minesweeper game struct
-void _showSeed(minesweeper_struct *game)
-{
-    printf("\nSEED: %d\n", game->current_seed);
+    if (game->mines_amt != batch->mines_amt)
+    {
+        game->mines_amt = batch->mines_amt;
 
-    _waitForEnter();
+        game->hash = _zobristBoard(game);
+    }
+
+    game->journal_len = 0;
+
+    game->game_over = 0;
+
+    game->safe_total = game->rows * game->cols - game->mines_amt;
+
+    game->mines_initialized = 1;
 }
 
-// _showGameEnd(): Reveals the board and displays win/loss message
-// @param game: Pointer to the minesweeper game struct
-// @param won: 1 if player won, 0 if player lost
-void _showGameEnd(minesweeper_struct *game, int won)
+// minesweeper_batch_destroy(): Free all memory associated with a batch
+// @param batch: Pointer to the batch
+void minesweeper_batch_destroy(minesweeper_batch *batch)
 {
-    _revealBoard(game);
-    _displayGame(game);
-    printf(won ? "\n--- YOU WIN! ---\n" : "\n--- BOMB HIT. GAME OVER. ---\n");
+    assert(batch != NULL);
+
+    free(batch->cells);
+    free(batch->mines);
+    free(batch->needed);
+    free(batch->rng_state);
+    free(batch);
 }
 
 // =====================
@@ -515,6 +1948,300 @@ Vector2D *get_Radius(input_coordinate *coords, minesweeper_struct *game, int *ou
     return radius;
 }
 
+// =====================
+//  RAW INPUT API
+// =====================
+
+#ifndef _WIN32
+
+// Terminal state for the signal and exit hooks, which cannot reach the caller's saved copy
+static struct termios raw_saved;
+static volatile sig_atomic_t raw_active = 0;
+
+// _rawRestoreTerminal(): Show the cursor, reset colours and restore the saved terminal settings
+// Uses only async-signal-safe calls so the signal handler can share it
+void _rawRestoreTerminal(void)
+{
+    static const char reset[] = "\x1b[0m\x1b[?25h\n";
+
+    if (!raw_active)
+        return;
+
+    raw_active = 0;
+
+    // Restore the settings first: a closed or redirected stdout must not leave the terminal raw
+    tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw_saved);
+
+    ssize_t written = write(STDOUT_FILENO, reset, sizeof(reset) - 1);
+
+    (void)written;
+}
+
+// _rawSignalRestore(): Restore the terminal on SIGINT/SIGTERM, then die by the same signal
+// @param sig: The signal received
+void _rawSignalRestore(int sig)
+{
+    _rawRestoreTerminal();
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+// _enableRawMode(): Switch stdin to unbuffered, unechoed input
+// The first call also installs SIGINT/SIGTERM handlers and an atexit hook that undo it
+// @param saved: Pointer to store the previous terminal settings
+// @return: 1 on success, 0 if stdin is not a terminal
+int _enableRawMode(struct termios *saved)
+{
+    static int hooks_installed = 0;
+
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, saved) != 0)
+        return 0;
+
+    if (!hooks_installed)
+    {
+        struct sigaction action;
+
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = _rawSignalRestore;
+        sigemptyset(&action.sa_mask);
+
+        sigaction(SIGINT, &action, NULL);
+        sigaction(SIGTERM, &action, NULL);
+        atexit(_rawRestoreTerminal);
+
+        hooks_installed = 1;
+    }
+
+    struct termios raw = *saved;
+
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+
+    raw_saved = *saved;
+    raw_active = 1;
+
+    if (tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw) != 0)
+    {
+        raw_active = 0;
+        return 0;
+    }
+
+    return 1;
+}
+
+// _disableRawMode(): Restore the terminal settings saved by _enableRawMode()
+// @param saved: The previous terminal settings
+void _disableRawMode(const struct termios *saved)
+{
+    raw_active = 0;
+    tcsetattr(STDIN_FILENO, TCSAFLUSH, saved);
+}
+
+// _readKey(): Wait for a keypress, decoding arrow-key escape sequences
+// @param timeout_ms: Milliseconds to wait, or -1 to block
+// @return: The key, one of key_up/key_down/key_left/key_right, -1 on timeout or interruption,
+//          or key_eof once stdin reaches end of file or hangs up
+int _readKey(int timeout_ms)
+{
+    struct pollfd input = {STDIN_FILENO, POLLIN, 0};
+    unsigned char c;
+
+    int ready = poll(&input, 1, timeout_ms);
+
+    if (ready == 0 || (ready < 0 && errno == EINTR))
+        return -1;
+
+    if (ready < 0)
+        return key_eof;
+
+    // A hangup still reports POLLIN while data is queued, so only the read decides end of input
+    ssize_t got = read(STDIN_FILENO, &c, 1);
+
+    if (got < 0 && (errno == EINTR || errno == EAGAIN))
+        return -1;
+
+    if (got != 1)
+        return key_eof;
+
+    if (c != '\x1b')
+        return c;
+
+    // A lone Escape has nothing queued behind it; an arrow key arrives as ESC [ A..D
+    unsigned char seq[2];
+
+    if (poll(&input, 1, 10) <= 0 || read(STDIN_FILENO, &seq[0], 1) != 1)
+        return c;
+
+    if (poll(&input, 1, 10) <= 0 || read(STDIN_FILENO, &seq[1], 1) != 1)
+        return c;
+
+    if (seq[0] != '[')
+        return c;
+
+    switch (seq[1])
+    {
+    case 'A':
+        return key_up;
+    case 'B':
+        return key_down;
+    case 'C':
+        return key_right;
+    case 'D':
+        return key_left;
+    default:
+        return c;
+    }
+}
+
+// _drawCell(): Redraw a single cell of the visible matrix in place
+// @param game: Pointer to the game state
+// @param row: Row of the cell
+// @param col: Column of the cell
+// @param highlighted: 1 to draw the cell under the cursor
+void _drawCell(minesweeper_struct *game, int row, int col, int highlighted)
+{
+    char dataAttribute = _visibleAt(game, row, col);
+    int color = _getColor(dataAttribute);
+
+    // Matches _printMatrixData(): a 3-column row label, then 2 columns per cell
+    printf("\x1b[%d;%dH%s\x1b[38;5;%dm%c\x1b[0m", row + 1, 4 + col * 2,
+            highlighted ? "\x1b[7m" : "", color, dataAttribute);
+}
+
+// _drawStatus(): Replace the status line below the board
+// @param game: Pointer to the game state
+// @param message: The text to show
+void _drawStatus(minesweeper_struct *game, const char *message)
+{
+    printf("\x1b[%d;1H\x1b[2K%s", game->rows + 3, message);
+}
+
+// _rawEventRedraw(): Cell event callback that redraws only the changed cell
+// @param event: The cell change
+// @param userdata: Pointer to the raw_view
+void _rawEventRedraw(const cell_event *event, void *userdata)
+{
+    raw_view *view = userdata;
+
+    _drawCell(view->game, event->row, event->col,
+            event->row == view->cursor_row && event->col == view->cursor_col);
+}
+
+// minesweeper_game_loop_raw(): Cursor-driven game loop reading single keys in raw mode
+// Falls back to minesweeper_game_loop() when stdin is not a terminal
+// @param game: Pointer to the game state
+void minesweeper_game_loop_raw(minesweeper_struct *game)
+{
+    struct termios saved;
+
+    assert(game->mapped_base == NULL);
+
+    if (!_enableRawMode(&saved))
+    {
+        minesweeper_game_loop(game);
+        return;
+    }
+
+    raw_view view = {game, game->rows / 2, game->cols / 2};
+    const char *controls = "Arrows/HJKL: move  Space: reveal  F: flag  C: chord  U: undo  S: seed  Q: quit";
+    int won = 0;
+    int quit = 0;
+
+    printf("\x1b[2J\x1b[H\x1b[?25l");
+    _printMatrixData(game->visible_matrix, game->rows, game->cols);
+    _drawCell(game, view.cursor_row, view.cursor_col, 1);
+    _drawStatus(game, controls);
+    fflush(stdout);
+
+    minesweeper_set_event_callback(game, _rawEventRedraw, &view);
+
+    while (!game->game_over && !won && !quit)
+    {
+        int key = _readKey(-1);
+        int row = view.cursor_row;
+        int col = view.cursor_col;
+
+        // The controls line shows capitals, so letters match either case; arrow codes sit above 255
+        if (key >= 0 && key <= UCHAR_MAX)
+            key = tolower(key);
+
+        switch (key)
+        {
+        case key_up:
+        case 'k':
+            row = row > 0 ? row - 1 : row;
+            break;
+        case key_down:
+        case 'j':
+            row = row < game->rows - 1 ? row + 1 : row;
+            break;
+        case key_left:
+        case 'h':
+            col = col > 0 ? col - 1 : col;
+            break;
+        case key_right:
+        case 'l':
+            col = col < game->cols - 1 ? col + 1 : col;
+            break;
+        case ' ':
+        case '\r':
+        case '\n':
+            minesweeper_make(game, row, col, 0);
+            won = !game->game_over && _checkWin(game);
+            break;
+        case 'f':
+            minesweeper_make(game, row, col, 1);
+            break;
+        case 'c':
+        {
+            batch_move chord = {row, col, move_chord};
+            won = minesweeper_apply_batch(game, &chord, 1, NULL) == 1;
+            break;
+        }
+        case 'u':
+            minesweeper_unmake(game);
+            break;
+        case 's':
+        {
+            char message[64];
+            snprintf(message, sizeof(message), "SEED: %d", game->current_seed);
+            _drawStatus(game, message);
+            break;
+        }
+        case 'q':
+        case key_eof:
+            quit = 1;
+            break;
+        default:
+            _drawStatus(game, controls);
+            break;
+        }
+
+        if (row != view.cursor_row || col != view.cursor_col)
+        {
+            _drawCell(game, view.cursor_row, view.cursor_col, 0);
+            view.cursor_row = row;
+            view.cursor_col = col;
+            _drawCell(game, row, col, 1);
+        }
+
+        fflush(stdout);
+    }
+
+    minesweeper_set_event_callback(game, NULL, NULL);
+
+    printf("\x1b[0m\x1b[?25h\x1b[%d;1H\n", game->rows + 3);
+    _disableRawMode(&saved);
+
+    if (quit)
+        printf("\nEXITING GAME.\n");
+    else
+        _showGameEnd(game, won);
+}
+
+#endif
+
 // =====================
 //  MAIN API
 // =====================
@@ -527,37 +2254,158 @@ Vector2D *get_Radius(input_coordinate *coords, minesweeper_struct *game, int *ou
 // @return: Pointer to the initialized game struct
 minesweeper_struct *minesweeper_init(int seed, int rows, int cols, int mines_amt)
 {
-    assert(rows < 27);
+    // Rows print as two digits and columns are named A-Z
+    assert(rows < 100);
     assert(cols < 27);
     assert(mines_amt < rows * cols);
 
-    srand(seed);
-
     minesweeper_struct *game = malloc(sizeof(minesweeper_struct));
 
+    game->visible_matrix = init_matrix_2D(rows, cols, starting_char);
+
+    game->hidden_matrix = init_hidden_matrix(rows, cols, starting_char);
+
+    game->hidden_plane = NULL;
+
+    game->visible_plane = NULL;
+
+    game->mapped_base = NULL;
+
+    game->mapped_size = 0;
+
+    _initGameState(game, seed, rows, cols, mines_amt);
+
+    return game;
+}
+
+// _initGameState(): Set every field of a game apart from its board storage, which must already be assigned and blank
+// @param game: Pointer to the game state
+// @param seed: The random seed to set
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mines_amt: The amount of mines to place
+void _initGameState(minesweeper_struct *game, int seed, int rows, int cols, int mines_amt)
+{
     game->rows = rows;
 
     game->cols = cols;
 
     game->mines_amt = mines_amt;
 
-    game->visible_matrix = init_matrix_2D(rows, cols, starting_char);
-
-    game->hidden_matrix = init_hidden_matrix(rows, cols, starting_char);
-
     game->game_over = 0;
 
     game->mines_initialized = 0;
 
     game->current_seed = seed;
 
+    game->rng_state = _splitMix64((uint64_t)(uint32_t)seed);
+
+    game->journal = NULL;
+
+    game->journal_len = 0;
+
+    game->journal_cap = 0;
+
+    game->hash = _zobristEmpty(game);
+
+    game->revealed_safe = 0;
+
+    game->safe_total = 0;
+
+    game->region_of = NULL;
+
+    game->region_offsets = NULL;
+
+    game->region_spans = NULL;
+
+    game->region_flags = NULL;
+
+    game->region_count = 0;
+
+    game->region_buffer = NULL;
+
+    game->region_buffer_size = 0;
+
+    game->region_used = 0;
+
+    game->event_ring = NULL;
+
+    game->event_callback = NULL;
+
+    game->event_userdata = NULL;
+}
+
+// minesweeper_init_mapped(): Initialize a new game whose hidden and visible planes live in a file-backed mapping
+// Lets the board outgrow RAM: each plane takes one byte per cell, so a 100000x100000 board maps 20 GB.
+// Creating the game touches no cell. The first reveal writes the hidden plane in sequential passes,
+// and later moves touch only the pages they reveal. Only the journal and flood stack use the heap,
+// in proportion to the cells revealed. The text loops and batch_load need an in-memory game
+// @param seed: The random seed to set
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mines_amt: The amount of mines to place
+// @param path: File to create or truncate as backing storage
+// @return: Pointer to the initialized game struct, or NULL if the file cannot be mapped
+minesweeper_struct *minesweeper_init_mapped(int seed, int rows, int cols, int mines_amt, const char *path)
+{
+    assert(rows > 0 && cols > 0);
+    assert(mines_amt < (int64_t)rows * cols);
+
+#ifdef _WIN32
+    (void)seed;
+    (void)path;
+    return NULL;
+#else
+    size_t plane = (size_t)rows * cols;
+    size_t size = plane * 2;
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0)
+        return NULL;
+
+    // The file starts out as a hole, which reads as zeros, a blank board in both planes
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (base == MAP_FAILED)
+        return NULL;
+
+    minesweeper_struct *game = malloc(sizeof(minesweeper_struct));
+
+    assert(game != NULL);
+
+    game->hidden_matrix = NULL;
+
+    game->visible_matrix = NULL;
+
+    game->hidden_plane = base;
+
+    game->visible_plane = (char *)base + plane;
+
+    game->mapped_base = base;
+
+    game->mapped_size = size;
+
+    _initGameState(game, seed, rows, cols, mines_amt);
+
     return game;
+#endif
 }
 
 // minesweeper_game_loop(): Main game loop handling input, moves, and win/lose conditions
 // @param game: Pointer to the game state
 void minesweeper_game_loop(minesweeper_struct *game)
 {
+    assert(game->mapped_base == NULL);
+
     while (!game->game_over)
     {
         _displayGame(game);
@@ -582,6 +2430,12 @@ void minesweeper_game_loop(minesweeper_struct *game)
             continue;
         }
 
+        if (strcmp(move_str, "--UNDO") == 0)
+        {
+            minesweeper_unmake(game);
+            continue;
+        }
+
         input_coordinate coords;
 
         int is_flag;
@@ -593,14 +2447,10 @@ void minesweeper_game_loop(minesweeper_struct *game)
             continue;
         }
 
-        if (is_flag)
-        {
-            _toggleFlag(game, coords.row, coords.col);
-        }
-        else
-        {
-            _renderMove(game, coords.row, coords.col);
+        minesweeper_make(game, coords.row, coords.col, is_flag);
 
+        if (!is_flag)
+        {
             if (_checkWin(game))
             {
                 _showGameEnd(game, 1);
@@ -621,7 +2471,18 @@ void minesweeper_destroy(minesweeper_struct *game)
 {
     assert(game != NULL);
 
-    _freeMatrix(game->hidden_matrix, game->rows);
-    _freeMatrix(game->visible_matrix, game->rows);
+    if (game->mapped_base != NULL)
+    {
+#ifndef _WIN32
+        munmap(game->mapped_base, game->mapped_size);
+#endif
+    }
+    else
+    {
+        _freeMatrix(game->hidden_matrix, game->rows);
+        _freeMatrix(game->visible_matrix, game->rows);
+    }
+    free(game->journal);
+    free(game->region_buffer);
     free(game);
 }
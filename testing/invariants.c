@@ -0,0 +1,336 @@
+#include "../src/minesweeper.h"
+
+// =====================
+//  DEFINES
+// =====================
+
+#define walk_seeds 40
+#define walk_steps 300
+#define ring_capacity 65536
+#define mapped_path "invariants_board.bin"
+
+// =====================
+//  STRUCTS
+// =====================
+
+typedef struct
+{
+    int rows;
+    int cols;
+    int mines;
+} board_size;
+
+typedef struct
+{
+    char *cells;
+    uint64_t hash;
+    int64_t revealed_safe;
+    int game_over;
+} board_snapshot;
+
+// =====================
+//  CHECKS
+// =====================
+
+static int failures = 0;
+
+// _expect(): Record a failed invariant with the game and step it failed on
+// @param ok: The invariant's value
+// @param what: Description of the invariant
+// @param size: The board size being walked
+// @param seed: The game seed
+// @param step: The step of the walk
+// @return: ok, so callers can stop at the first failure of a game
+static int _expect(int ok, const char *what, const board_size *size, int seed, int step)
+{
+    if (!ok)
+    {
+        fprintf(stderr, "FAIL %s: %dx%d mines=%d seed=%d step=%d\n", what, size->rows, size->cols, size->mines,
+                seed, step);
+        failures++;
+    }
+
+    return ok;
+}
+
+// _takeSnapshot(): Copy the visible board and the counters an undo must restore
+// @param game: Pointer to the game state
+// @param snapshot: The snapshot to fill; its cells array holds rows * cols entries
+static void _takeSnapshot(const minesweeper_struct *game, board_snapshot *snapshot)
+{
+    for (int r = 0; r < game->rows; r++)
+        for (int c = 0; c < game->cols; c++)
+            snapshot->cells[r * game->cols + c] = _visibleAt(game, r, c);
+
+    snapshot->hash = game->hash;
+    snapshot->revealed_safe = game->revealed_safe;
+    snapshot->game_over = game->game_over;
+}
+
+// _sameAsSnapshot(): Compare a game with a snapshot taken earlier
+// @param game: Pointer to the game state
+// @param snapshot: The snapshot
+// @return: 1 if the board and counters match, 0 otherwise
+static int _sameAsSnapshot(const minesweeper_struct *game, const board_snapshot *snapshot)
+{
+    for (int r = 0; r < game->rows; r++)
+        for (int c = 0; c < game->cols; c++)
+            if (snapshot->cells[r * game->cols + c] != _visibleAt(game, r, c))
+                return 0;
+
+    return snapshot->hash == game->hash && snapshot->revealed_safe == game->revealed_safe &&
+           snapshot->game_over == game->game_over;
+}
+
+// _countersHold(): Recount the incrementally kept hash, revealed-cell count and region flag counts
+// @param game: Pointer to the game state
+// @return: 1 if every kept value matches a recount from scratch, 0 otherwise
+static int _countersHold(minesweeper_struct *game)
+{
+    int64_t revealed = 0;
+
+    for (int r = 0; r < game->rows; r++)
+    {
+        for (int c = 0; c < game->cols; c++)
+        {
+            char data = _visibleAt(game, r, c);
+
+            revealed += data >= '0' && data <= '8';
+        }
+    }
+
+    if (revealed != game->revealed_safe || _zobristBoard(game) != game->hash)
+        return 0;
+
+    if (game->region_of == NULL)
+        return 1;
+
+    for (int region = 0; region < game->region_count; region++)
+    {
+        int flags = 0;
+
+        for (int cell = 0; cell < game->rows * game->cols; cell++)
+            flags += game->region_of[cell] == region &&
+                     _visibleAt(game, cell / game->cols, cell % game->cols) == flag_char;
+
+        if (flags != game->region_flags[region])
+            return 0;
+    }
+
+    return 1;
+}
+
+// _sameBoard(): Compare the visible boards and counters of two games of the same size
+// @param a: The first game
+// @param b: The second game
+// @return: 1 if they match, 0 otherwise
+static int _sameBoard(const minesweeper_struct *a, const minesweeper_struct *b)
+{
+    for (int r = 0; r < a->rows; r++)
+        for (int c = 0; c < a->cols; c++)
+            if (_visibleAt(a, r, c) != _visibleAt(b, r, c))
+                return 0;
+
+    return a->hash == b->hash && a->revealed_safe == b->revealed_safe && a->game_over == b->game_over &&
+           a->journal_len == b->journal_len;
+}
+
+// _mirrorMatches(): Apply every queued cell event to a mirror board and compare it with the game
+// @param game: Pointer to the game state
+// @param ring: The ring attached to the game
+// @param mirror: The mirror board, rows * cols characters
+// @return: 1 if the mirror matches the visible board and nothing was dropped, 0 otherwise
+static int _mirrorMatches(const minesweeper_struct *game, cell_event_ring *ring, char *mirror)
+{
+    cell_event event;
+
+    while (cell_event_ring_pop(ring, &event))
+        mirror[event.row * game->cols + event.col] = event.data;
+
+    for (int r = 0; r < game->rows; r++)
+        for (int c = 0; c < game->cols; c++)
+            if (mirror[r * game->cols + c] != _visibleAt(game, r, c))
+                return 0;
+
+    return atomic_load(&ring->dropped) == 0;
+}
+
+// =====================
+//  WALKS
+// =====================
+
+// _walkGame(): Play random moves on an in-memory and a mapped game with the same seed, checking every step
+// The in-memory game reveals openings from the region index or a preset search, the mapped one always
+// floods, so comparing them checks the span reveal against the flood. Flags are aimed at hidden zero
+// cells half the time, so openings cut short by a flag are exercised too
+// @param size: The board size
+// @param seed: The game seed
+static void _walkGame(const board_size *size, int seed)
+{
+    int cells = size->rows * size->cols;
+    minesweeper_struct *game = minesweeper_init(seed, size->rows, size->cols, size->mines);
+    minesweeper_struct *mapped = minesweeper_init_mapped(seed, size->rows, size->cols, size->mines, mapped_path);
+    cell_event_ring *ring = cell_event_ring_init(ring_capacity);
+    board_snapshot *history = malloc((walk_steps + 1) * sizeof(board_snapshot));
+    char *mirror = malloc(cells);
+    uint64_t state = _splitMix64((uint64_t)seed * 31 + (uint64_t)cells);
+    int depth = 0;
+
+    assert(mapped != NULL && history != NULL && mirror != NULL);
+
+    for (int i = 0; i <= walk_steps; i++)
+    {
+        history[i].cells = malloc(cells);
+        assert(history[i].cells != NULL);
+    }
+
+    memset(mirror, starting_char, cells);
+    minesweeper_set_event_ring(game, ring);
+
+    for (int step = 0; step < walk_steps; step++)
+    {
+        int row = (int)(_nextRandom(&state) % (uint64_t)size->rows);
+        int col = (int)(_nextRandom(&state) % (uint64_t)size->cols);
+        int roll = (int)(_nextRandom(&state) % 100);
+
+        // A lost game has nothing left to try but undo
+        if (game->game_over)
+            roll = 99;
+
+        if (step == 0)
+        {
+            row = size->rows / 2;
+            col = size->cols / 2;
+            roll = 0;
+        }
+
+        if (roll >= 85)
+        {
+            int undone = minesweeper_unmake(game);
+
+            if (!_expect(undone == minesweeper_unmake(mapped), "unmake agrees", size, seed, step) ||
+                    !_expect(undone == (depth > 0), "unmake only with history", size, seed, step))
+                break;
+
+            if (undone && !_expect(_sameAsSnapshot(game, &history[--depth]), "unmake restores", size, seed, step))
+                break;
+        }
+        else
+        {
+            batch_move move = {row, col, move_reveal};
+
+            if (roll >= 70)
+                move.type = move_chord;
+            else if (roll >= 50)
+                move.type = move_flag;
+
+            // Point half the flags at a hidden zero, so a later reveal meets a flagged opening
+            if (move.type == move_flag && game->mines_initialized && (roll & 1))
+            {
+                for (int cell = (int)(_nextRandom(&state) % (uint64_t)cells), tries = 0; tries < cells; tries++)
+                {
+                    int r = (cell + tries) % cells / size->cols;
+                    int c = (cell + tries) % cells % size->cols;
+
+                    if (_hiddenAt(game, r, c) == '0' && _visibleAt(game, r, c) == starting_char)
+                    {
+                        move.row = r;
+                        move.col = c;
+                        break;
+                    }
+                }
+            }
+
+            size_t before = game->journal_len;
+
+            _takeSnapshot(game, &history[depth]);
+
+            minesweeper_apply_batch(game, &move, 1, NULL);
+            minesweeper_apply_batch(mapped, &move, 1, NULL);
+
+            // A move that changed nothing leaves no step to undo
+            if (game->journal_len != before)
+                depth++;
+        }
+
+        if (!_expect(_countersHold(game), "counters hold", size, seed, step) ||
+                !_expect(_countersHold(mapped), "mapped counters hold", size, seed, step) ||
+                !_expect(_sameBoard(game, mapped), "mapped matches memory", size, seed, step) ||
+                !_expect(_mirrorMatches(game, ring, mirror), "event mirror matches", size, seed, step))
+            break;
+    }
+
+    // Undoing everything has to get back to a blank board
+    while (minesweeper_unmake(game))
+        ;
+
+    _expect(game->revealed_safe == 0 && game->hash == _zobristEmpty(game), "full unmake is blank", size, seed,
+            walk_steps);
+
+    for (int i = 0; i <= walk_steps; i++)
+        free(history[i].cells);
+
+    free(history);
+    free(mirror);
+    cell_event_ring_destroy(ring);
+    minesweeper_destroy(game);
+    minesweeper_destroy(mapped);
+}
+
+// _checkRingOverflow(): Fill a small ring past capacity and check what is kept and dropped
+static void _checkRingOverflow(void)
+{
+    board_size size = {0, 0, 0};
+    cell_event_ring *ring = cell_event_ring_init(3);
+    cell_event event;
+    int stored = 0;
+
+    for (int i = 0; i < 10; i++)
+    {
+        cell_event pushed = {i, i, (char)('0' + i)};
+
+        stored += cell_event_ring_push(ring, &pushed);
+    }
+
+    _expect(stored == 4 && atomic_load(&ring->dropped) == 6, "ring rounds up and drops", &size, 0, 0);
+
+    for (int i = 0; i < 4; i++)
+        _expect(cell_event_ring_pop(ring, &event) && event.row == i, "ring keeps order", &size, 0, i);
+
+    _expect(!cell_event_ring_pop(ring, &event), "ring drains", &size, 0, 4);
+
+    cell_event_ring_destroy(ring);
+}
+
+// =====================
+//  MAIN
+// =====================
+
+int main(void)
+{
+    const board_size sizes[] = {
+        {beginner_rows, beginner_cols, 10},
+        {intermediate_rows, intermediate_cols, 40},
+        {expert_rows, expert_cols, 99},
+        {20, 13, 30},
+        {99, 26, 200},
+    };
+
+    _checkRingOverflow();
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+        for (int seed = 1; seed <= walk_seeds; seed++)
+            _walkGame(&sizes[i], seed);
+
+    remove(mapped_path);
+
+    if (failures > 0)
+    {
+        fprintf(stderr, "%d invariant checks failed\n", failures);
+        return 1;
+    }
+
+    printf("all invariants hold\n");
+
+    return 0;
+}
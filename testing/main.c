@@ -12,7 +12,14 @@ int main(int argc, char* argv[]) {
 
     minesweeper_struct *game = minesweeper_init(time(NULL), rows, cols, mines);
 
+#ifndef _WIN32
+    if (argc > 4 && strcmp(argv[4], "--raw") == 0)
+        minesweeper_game_loop_raw(game);
+    else
+        minesweeper_game_loop(game);
+#else
     minesweeper_game_loop(game);
+#endif
     minesweeper_destroy(game);
 
     return 0;
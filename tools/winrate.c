@@ -0,0 +1,954 @@
+#include "../src/minesweeper.h"
+
+#include <math.h>
+#include <pthread.h>
+
+// =====================
+//  DEFINES
+// =====================
+
+#define max_grid_values 32
+
+#define policy_center 0
+#define policy_corner 1
+#define policy_random 2
+
+// =====================
+//  STRUCTS
+// =====================
+
+typedef struct
+{
+    int rows;
+    int cols;
+    int mines;
+    double requested_density;
+    double density;
+    int policy;
+    long pilot_games;
+    long games;
+    double sum;
+    double sum_sq;
+    double ci_low;
+    double ci_high;
+    int converged;
+} grid_point;
+
+typedef struct
+{
+    grid_point *point;
+    int point_index;
+    uint64_t base_seed;
+    int plain;
+    long first_game;
+    long round_games;
+    double *outcomes;
+    _Atomic long next_game;
+} round_job;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    pthread_t *threads;
+    int thread_count;
+    round_job *job;
+    long generation;
+    int busy;
+    int shutdown;
+} worker_pool;
+
+typedef struct
+{
+    int sizes[max_grid_values][2];
+    int size_count;
+    double densities[max_grid_values];
+    int density_count;
+    int policies[max_grid_values];
+    int policy_count;
+    double precision;
+    int relative;
+    double z;
+    int plain;
+    long pilot_games;
+    long max_games;
+    long round_games;
+    int threads;
+    uint64_t seed;
+    int json;
+    const char *output;
+} analysis_options;
+
+static const char *policy_names[] = {"center", "corner", "random"};
+
+// =====================
+//  SOLVER
+// =====================
+
+// _playGame(): Play one seeded game with a single-cell constraint solver, guessing when stuck
+// The solver's deductions are always safe, so a game is only lost on a uniform random guess. Unless
+// plain is set, each guess is not played out: the game survives it, the weight is multiplied by the
+// guess's survival probability (safe unknown cells over unknown cells), and play continues from a
+// uniformly chosen safe cell. The final weight is an unbiased estimate of the win probability with
+// lower variance than the 0/1 outcome, since the guesses' luck is averaged out exactly
+// @param rows: Number of rows
+// @param cols: Number of columns
+// @param mines: The amount of mines to place
+// @param policy: Where the first click goes: policy_center, policy_corner or policy_random
+// @param plain: 1 to play guesses out and return the raw 0/1 outcome
+// @param seed: Seed for both the board and the solver's guesses
+// @return: The win weight in [0, 1]; exactly 1 or 0 when plain is set
+static double _playGame(int rows, int cols, int mines, int policy, int plain, uint64_t seed)
+{
+    minesweeper_struct *game = minesweeper_init((int)(uint32_t)seed, rows, cols, mines);
+    uint64_t guess_state = _splitMix64(seed ^ 0xA5A5A5A5A5A5A5A5ULL);
+
+    int cells = rows * cols;
+    batch_move *moves = malloc(cells * sizeof(batch_move));
+    unsigned char *queued = malloc(cells);
+
+    assert(moves != NULL && queued != NULL);
+
+    batch_move first = {rows / 2, cols / 2, move_reveal};
+
+    if (policy == policy_corner)
+    {
+        first.row = 0;
+        first.col = 0;
+    }
+    else if (policy == policy_random)
+    {
+        first.row = _nextRandom(&guess_state) % rows;
+        first.col = _nextRandom(&guess_state) % cols;
+    }
+
+    double weight = 1.0;
+    int status = minesweeper_apply_batch(game, &first, 1, NULL);
+
+    while (status == 0)
+    {
+        int count = 0;
+
+        memset(queued, 0, cells);
+
+        for (int r = 0; r < rows; r++)
+        {
+            for (int c = 0; c < cols; c++)
+            {
+                char data = game->visible_matrix[r][c].data;
+
+                if (data < '1' || data > '8')
+                    continue;
+
+                int unknown = 0;
+                int flagged = 0;
+
+                for (int dr = -1; dr <= 1; dr++)
+                {
+                    for (int dc = -1; dc <= 1; dc++)
+                    {
+                        int nr = r + dr;
+                        int nc = c + dc;
+
+                        if (nr < 0 || nr >= rows || nc < 0 || nc >= cols)
+                            continue;
+
+                        unknown += game->visible_matrix[nr][nc].data == starting_char;
+                        flagged += game->visible_matrix[nr][nc].data == flag_char;
+                    }
+                }
+
+                if (unknown == 0)
+                    continue;
+
+                if (flagged == data - '0')
+                {
+                    moves[count++] = (batch_move){r, c, move_chord};
+                    continue;
+                }
+
+                if (unknown + flagged != data - '0')
+                    continue;
+
+                for (int dr = -1; dr <= 1; dr++)
+                {
+                    for (int dc = -1; dc <= 1; dc++)
+                    {
+                        int nr = r + dr;
+                        int nc = c + dc;
+
+                        if (nr < 0 || nr >= rows || nc < 0 || nc >= cols)
+                            continue;
+
+                        if (game->visible_matrix[nr][nc].data != starting_char || queued[nr * cols + nc])
+                            continue;
+
+                        queued[nr * cols + nc] = 1;
+                        moves[count++] = (batch_move){nr, nc, move_flag};
+                    }
+                }
+            }
+        }
+
+        if (count == 0)
+        {
+            int unknown = 0;
+            int safe = 0;
+
+            for (int i = 0; i < cells; i++)
+            {
+                if (game->visible_matrix[i / cols][i % cols].data != starting_char)
+                    continue;
+
+                unknown++;
+                safe += game->hidden_matrix[i / cols][i % cols].data != mine_char;
+            }
+
+            // A plain guess picks any unknown cell; otherwise only safe ones, paying for the odds
+            int candidates = plain ? unknown : safe;
+            int pick = _nextRandom(&guess_state) % candidates;
+
+            if (!plain)
+                weight *= (double)safe / unknown;
+
+            for (int i = 0; i < cells; i++)
+            {
+                if (game->visible_matrix[i / cols][i % cols].data == starting_char &&
+                        (plain || game->hidden_matrix[i / cols][i % cols].data != mine_char) && pick-- == 0)
+                {
+                    moves[count++] = (batch_move){i / cols, i % cols, move_reveal};
+                    break;
+                }
+            }
+        }
+
+        status = minesweeper_apply_batch(game, moves, count, NULL);
+    }
+
+    free(moves);
+    free(queued);
+    minesweeper_destroy(game);
+
+    return status == 1 ? weight : 0.0;
+}
+
+// =====================
+//  STATISTICS
+// =====================
+
+// _wilsonInterval(): Wilson score interval for a binomial proportion
+// @param wins: Number of successes
+// @param games: Number of trials
+// @param z: Normal quantile of the confidence level, e.g. 1.96 for 95%
+// @param low: Pointer to store the lower bound
+// @param high: Pointer to store the upper bound
+static void _wilsonInterval(long wins, long games, double z, double *low, double *high)
+{
+    double n = (double)games;
+    double p = wins / n;
+    double z2 = z * z;
+    double denom = 1.0 + z2 / n;
+    double center = (p + z2 / (2.0 * n)) / denom;
+    double half = z * sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denom;
+
+    *low = center - half;
+    *high = center + half;
+}
+
+// _meanInterval(): Normal-approximation interval for the mean of outcomes in [0, 1], clipped to [0, 1]
+// @param sum: Sum of the outcomes
+// @param sum_sq: Sum of the squared outcomes
+// @param games: Number of outcomes
+// @param z: Normal quantile of the confidence level
+// @param low: Pointer to store the lower bound
+// @param high: Pointer to store the upper bound
+static void _meanInterval(double sum, double sum_sq, long games, double z, double *low, double *high)
+{
+    double n = (double)games;
+    double mean = sum / n;
+    double variance = games > 1 ? fmax(sum_sq - sum * mean, 0.0) / (n - 1.0) : 0.25;
+    double half = z * sqrt(variance / n);
+
+    *low = fmax(mean - half, 0.0);
+    *high = fmin(mean + half, 1.0);
+}
+
+// _planGames(): Size a point's second stage from its pilot so the interval meets the precision
+// Uses an upper confidence bound on the pilot variance (from its fourth moment) and, for relative
+// precision, a lower bound on the mean, so the target is still met when the pilot is optimistic.
+// Outcomes lie in [0, 1], so the variance never exceeds 1/4 and an absolute target always has a
+// finite plan; the result is capped at max_games and never falls below the pilot size
+// @param outcomes: The pilot outcomes
+// @param count: Number of pilot outcomes
+// @param options: The analysis options
+// @return: Number of second-stage games
+static long _planGames(const double *outcomes, long count, const analysis_options *options)
+{
+    double n = (double)count;
+    double mean = 0.0;
+
+    for (long i = 0; i < count; i++)
+        mean += outcomes[i];
+
+    mean /= n;
+
+    double m2 = 0.0;
+    double m4 = 0.0;
+
+    for (long i = 0; i < count; i++)
+    {
+        double d = (outcomes[i] - mean) * (outcomes[i] - mean);
+
+        m2 += d;
+        m4 += d * d;
+    }
+
+    m2 /= n;
+    m4 /= n;
+
+    double variance = fmin(m2 + options->z * sqrt(fmax(m4 - m2 * m2, 0.0) / n), 0.25);
+    double target = options->precision;
+
+    if (options->relative)
+        target *= fmax(mean - options->z * sqrt(m2 / n), 0.0);
+
+    double games = target > 0.0 ? ceil(options->z * options->z * variance / (target * target)) : INFINITY;
+    long cap = options->max_games - count;
+
+    if (games > cap)
+        return cap;
+
+    return games < count ? count : (long)games;
+}
+
+// =====================
+//  WORKERS
+// =====================
+
+// _playRound(): Play games of a round until none are left, shared by every worker
+// @param job: The round to play
+static void _playRound(round_job *job)
+{
+    grid_point *point = job->point;
+
+    for (;;)
+    {
+        long i = atomic_fetch_add(&job->next_game, 1);
+
+        if (i >= job->round_games)
+            break;
+
+        // Seeds depend only on the grid point and game index, so results ignore the thread count;
+        // the base seed is mixed first, or nearby seeds would replay the same games in another order
+        uint64_t seed = _splitMix64(_splitMix64(job->base_seed) ^ ((uint64_t)job->point_index << 40) ^
+                (uint64_t)(job->first_game + i));
+
+        job->outcomes[i] = _playGame(point->rows, point->cols, point->mines, point->policy, job->plain, seed);
+    }
+}
+
+// _poolWorker(): Thread body that waits for each round the pool publishes and helps play it
+// @param arg: Pointer to the worker_pool
+// @return: NULL
+static void *_poolWorker(void *arg)
+{
+    worker_pool *pool = arg;
+    long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;)
+    {
+        while (!pool->shutdown && pool->generation == seen)
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+
+        if (pool->shutdown)
+            break;
+
+        seen = pool->generation;
+        round_job *job = pool->job;
+
+        pthread_mutex_unlock(&pool->lock);
+        _playRound(job);
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->busy == 0)
+            pthread_cond_signal(&pool->work_done);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+// _startPool(): Start the worker threads once for the whole run
+// @param pool: The pool to start
+// @param threads: Number of threads wanted
+// @return: Number of threads started; fewer than asked if pthread_create() failed part way
+static int _startPool(worker_pool *pool, int threads)
+{
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    pool->threads = malloc(threads * sizeof(pthread_t));
+    pool->thread_count = 0;
+    pool->job = NULL;
+    pool->generation = 0;
+    pool->busy = 0;
+    pool->shutdown = 0;
+
+    assert(pool->threads != NULL);
+
+    for (int t = 0; t < threads; t++)
+    {
+        int error = pthread_create(&pool->threads[t], NULL, _poolWorker, pool);
+
+        if (error != 0)
+        {
+            fprintf(stderr, "pthread_create failed after %d of %d threads: %s\n", t, threads, strerror(error));
+            break;
+        }
+
+        pool->thread_count++;
+    }
+
+    return pool->thread_count;
+}
+
+// _runRound(): Hand a round to every worker and wait until all of them are done with it
+// @param pool: The running pool
+// @param job: The round to play
+static void _runRound(worker_pool *pool, round_job *job)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    pool->job = job;
+    pool->busy = pool->thread_count;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+
+    while (pool->busy > 0)
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// _stopPool(): Stop and join the worker threads, then release the pool
+// @param pool: The pool to stop
+static void _stopPool(worker_pool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int t = 0; t < pool->thread_count; t++)
+        pthread_join(pool->threads[t], NULL);
+
+    free(pool->threads);
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+// _playGames(): Play a block of consecutive game indices for a point in rounds, streaming progress
+// @param point: The grid point
+// @param point_index: Index of the point, mixed into every game seed
+// @param options: The analysis options
+// @param pool: The running worker pool
+// @param first_game: Index of the first game of the block
+// @param count: Number of games in the block
+// @param outcomes: Array of count entries receiving each game's outcome
+// @param stage: Label for the progress lines
+static void _playGames(grid_point *point, int point_index, const analysis_options *options, worker_pool *pool,
+        long first_game, long count, double *outcomes, const char *stage)
+{
+    double sum = 0.0;
+    double sum_sq = 0.0;
+
+    for (long done = 0; done < count;)
+    {
+        round_job job;
+
+        job.point = point;
+        job.point_index = point_index;
+        job.base_seed = options->seed;
+        job.plain = options->plain;
+        job.first_game = first_game + done;
+        job.round_games = count - done < options->round_games ? count - done : options->round_games;
+        job.outcomes = outcomes + done;
+
+        atomic_init(&job.next_game, 0);
+
+        _runRound(pool, &job);
+
+        // Summed in game order, so the totals do not depend on which thread played what
+        for (long i = 0; i < job.round_games; i++)
+        {
+            sum += job.outcomes[i];
+            sum_sq += job.outcomes[i] * job.outcomes[i];
+        }
+
+        done += job.round_games;
+
+        double low;
+        double high;
+
+        _meanInterval(sum, sum_sq, done, options->z, &low, &high);
+
+        fprintf(stderr, "%dx%d mines=%d %s %s: games=%ld/%ld win=%.4f [%.4f, %.4f]\n",
+                point->rows, point->cols, point->mines, policy_names[point->policy], stage, done, count,
+                sum / done, low, high);
+    }
+}
+
+// _runPoint(): Estimate one grid point with a two-stage design
+// A pilot sizes the second stage, and the interval comes from the second stage alone. Its size is
+// fixed before any of its games are played, so the plain normal quantile keeps its coverage; a rule
+// that keeps checking the same games as they accumulate would need a wider, multiple-look quantile
+// @param point: The grid point, updated with the final estimate
+// @param point_index: Index of the point, mixed into every game seed
+// @param options: The analysis options
+// @param pool: The running worker pool
+static void _runPoint(grid_point *point, int point_index, const analysis_options *options, worker_pool *pool)
+{
+    double *outcomes = malloc(options->max_games * sizeof(double));
+
+    assert(outcomes != NULL);
+
+    point->pilot_games = options->pilot_games;
+
+    _playGames(point, point_index, options, pool, 0, point->pilot_games, outcomes, "pilot");
+
+    point->games = _planGames(outcomes, point->pilot_games, options);
+
+    _playGames(point, point_index, options, pool, point->pilot_games, point->games, outcomes, "final");
+
+    point->sum = 0.0;
+    point->sum_sq = 0.0;
+
+    for (long i = 0; i < point->games; i++)
+    {
+        point->sum += outcomes[i];
+        point->sum_sq += outcomes[i] * outcomes[i];
+    }
+
+    if (options->plain)
+        _wilsonInterval((long)point->sum, point->games, options->z, &point->ci_low, &point->ci_high);
+    else
+        _meanInterval(point->sum, point->sum_sq, point->games, options->z, &point->ci_low, &point->ci_high);
+
+    double half = (point->ci_high - point->ci_low) / 2.0;
+    double target = options->relative ? options->precision * point->sum / point->games : options->precision;
+
+    point->converged = half <= target;
+
+    free(outcomes);
+}
+
+// =====================
+//  REPORT
+// =====================
+
+// _writeReport(): Write every grid point as CSV or JSON
+// @param out: The stream to write to
+// @param points: The grid points
+// @param count: Number of grid points
+// @param json: 1 for JSON, 0 for CSV
+static void _writeReport(FILE *out, const grid_point *points, int count, int json)
+{
+    if (json)
+        fprintf(out, "[\n");
+    else
+        fprintf(out, "rows,cols,mines,requested_density,density,policy,pilot_games,games,win_rate,std_dev,"
+                "ci_low,ci_high,converged\n");
+
+    for (int i = 0; i < count; i++)
+    {
+        const grid_point *p = &points[i];
+        double rate = p->sum / p->games;
+        double std_dev = p->games > 1 ? sqrt(fmax(p->sum_sq - p->sum * rate, 0.0) / (p->games - 1)) : 0.0;
+
+        if (json)
+        {
+            fprintf(out, "  {\"rows\": %d, \"cols\": %d, \"mines\": %d, \"requested_density\": %.4f, "
+                    "\"density\": %.4f, \"policy\": \"%s\", \"pilot_games\": %ld, \"games\": %ld, "
+                    "\"win_rate\": %.6f, \"std_dev\": %.6f, \"ci_low\": %.6f, \"ci_high\": %.6f, \"converged\": %s}%s\n",
+                    p->rows, p->cols, p->mines, p->requested_density, p->density, policy_names[p->policy],
+                    p->pilot_games, p->games,
+                    rate, std_dev, p->ci_low, p->ci_high, p->converged ? "true" : "false", i + 1 < count ? "," : "");
+        }
+        else
+        {
+            fprintf(out, "%d,%d,%d,%.4f,%.4f,%s,%ld,%ld,%.6f,%.6f,%.6f,%.6f,%d\n",
+                    p->rows, p->cols, p->mines, p->requested_density, p->density, policy_names[p->policy],
+                    p->pilot_games, p->games,
+                    rate, std_dev, p->ci_low, p->ci_high, p->converged);
+        }
+    }
+
+    if (json)
+        fprintf(out, "]\n");
+}
+
+// =====================
+//  OPTIONS
+// =====================
+
+// _showUsage(): Print the command line options
+// @param program: Name of the executable
+static void _showUsage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n\n"
+            "  --sizes RxC,...       Board sizes (default 9x9,16x16)\n"
+            "  --densities D,...     Mine fractions of the board (default 0.12,0.16)\n"
+            "  --policies P,...      First click: center, corner, random (default center)\n"
+            "  --precision H         Target half-width of the confidence interval (default 0.01)\n"
+            "  --relative            Read --precision as a fraction of the win rate instead\n"
+            "  --z Z                 Normal quantile of the confidence level (default 1.96)\n"
+            "  --pilot N             Pilot games that size each point's final sample (default 400)\n"
+            "  --max-games N         Cap on pilot plus final games per point (default 100000)\n"
+            "  --plain               Play every guess out and score 0/1 instead of weighting\n"
+            "                        each game by the odds of surviving its guesses\n"
+            "  --round N             Games between progress lines (default 256)\n"
+            "  --threads N           Worker threads (default: online CPUs)\n"
+            "  --seed S              Base seed (default 1)\n"
+            "  --format csv|json     Report format (default csv)\n"
+            "  --output PATH         Report file (default stdout)\n",
+            program);
+}
+
+// _parseLong(): Parse a whole decimal integer within a range, rejecting trailing characters
+// @param text: The text to parse
+// @param low: Smallest accepted value
+// @param high: Largest accepted value
+// @param out: Pointer to store the value
+// @return: 1 on success, 0 on invalid input
+static int _parseLong(const char *text, long low, long high, long *out)
+{
+    char *end;
+
+    errno = 0;
+    long value = strtol(text, &end, 10);
+
+    if (end == text || *end != '\0' || errno == ERANGE || value < low || value > high)
+        return 0;
+
+    *out = value;
+
+    return 1;
+}
+
+// _parseDouble(): Parse a whole finite decimal number, rejecting trailing characters
+// @param text: The text to parse
+// @param out: Pointer to store the value
+// @return: 1 on success, 0 on invalid input
+static int _parseDouble(const char *text, double *out)
+{
+    char *end;
+
+    errno = 0;
+    double value = strtod(text, &end);
+
+    if (end == text || *end != '\0' || errno == ERANGE || !isfinite(value))
+        return 0;
+
+    *out = value;
+
+    return 1;
+}
+
+// _parseSeed(): Parse an unsigned 64-bit decimal seed, rejecting signs and trailing characters
+// @param text: The text to parse
+// @param out: Pointer to store the value
+// @return: 1 on success, 0 on invalid input
+static int _parseSeed(const char *text, uint64_t *out)
+{
+    char *end;
+
+    // strtoull() would accept and negate a leading minus sign
+    if (!isdigit((unsigned char)text[0]))
+        return 0;
+
+    errno = 0;
+    unsigned long long value = strtoull(text, &end, 10);
+
+    if (*end != '\0' || errno == ERANGE)
+        return 0;
+
+    *out = value;
+
+    return 1;
+}
+
+// _parseOptions(): Fill analysis options from the command line
+// @param argc: Argument count
+// @param argv: Argument values
+// @param options: Pointer to the options to fill
+// @return: 1 on success, 0 on invalid input
+static int _parseOptions(int argc, char *argv[], analysis_options *options)
+{
+    options->sizes[0][0] = beginner_rows;
+    options->sizes[0][1] = beginner_cols;
+    options->sizes[1][0] = intermediate_rows;
+    options->sizes[1][1] = intermediate_cols;
+    options->size_count = 2;
+    options->densities[0] = 0.12;
+    options->densities[1] = 0.16;
+    options->density_count = 2;
+    options->policies[0] = policy_center;
+    options->policy_count = 1;
+    options->precision = 0.01;
+    options->relative = 0;
+    options->z = 1.96;
+    options->plain = 0;
+    options->pilot_games = 400;
+    options->max_games = 100000;
+    options->round_games = 256;
+    options->threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    options->seed = 1;
+    options->json = 0;
+    options->output = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--relative") == 0)
+        {
+            options->relative = 1;
+            continue;
+        }
+        if (strcmp(argv[i], "--plain") == 0)
+        {
+            options->plain = 1;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            return 0;
+
+        const char *flag = argv[i];
+        char *value = argv[++i];
+
+        if (strcmp(flag, "--sizes") == 0)
+        {
+            options->size_count = 0;
+
+            for (char *token = strtok(value, ","); token; token = strtok(NULL, ","))
+            {
+                char *cross = strchr(token, 'x');
+                long rows;
+                long cols;
+
+                if (options->size_count == max_grid_values || cross == NULL)
+                    return 0;
+
+                *cross = '\0';
+
+                if (!_parseLong(token, 4, 99, &rows) || !_parseLong(cross + 1, 4, 26, &cols))
+                    return 0;
+
+                options->sizes[options->size_count][0] = (int)rows;
+                options->sizes[options->size_count][1] = (int)cols;
+                options->size_count++;
+            }
+        }
+        else if (strcmp(flag, "--densities") == 0)
+        {
+            options->density_count = 0;
+
+            for (char *token = strtok(value, ","); token; token = strtok(NULL, ","))
+            {
+                if (options->density_count == max_grid_values)
+                    return 0;
+
+                double density;
+
+                if (!_parseDouble(token, &density) || density <= 0.0 || density >= 1.0)
+                    return 0;
+
+                options->densities[options->density_count++] = density;
+            }
+        }
+        else if (strcmp(flag, "--policies") == 0)
+        {
+            options->policy_count = 0;
+
+            for (char *token = strtok(value, ","); token; token = strtok(NULL, ","))
+            {
+                int policy = -1;
+
+                for (int p = 0; p < 3; p++)
+                {
+                    if (strcmp(token, policy_names[p]) == 0)
+                        policy = p;
+                }
+
+                if (policy == -1 || options->policy_count == max_grid_values)
+                    return 0;
+
+                options->policies[options->policy_count++] = policy;
+            }
+        }
+        else if (strcmp(flag, "--precision") == 0)
+        {
+            if (!_parseDouble(value, &options->precision))
+                return 0;
+        }
+        else if (strcmp(flag, "--z") == 0)
+        {
+            if (!_parseDouble(value, &options->z))
+                return 0;
+        }
+        else if (strcmp(flag, "--pilot") == 0)
+        {
+            if (!_parseLong(value, 2, LONG_MAX / 2, &options->pilot_games))
+                return 0;
+        }
+        else if (strcmp(flag, "--max-games") == 0)
+        {
+            if (!_parseLong(value, 1, LONG_MAX, &options->max_games))
+                return 0;
+        }
+        else if (strcmp(flag, "--round") == 0)
+        {
+            if (!_parseLong(value, 1, LONG_MAX, &options->round_games))
+                return 0;
+        }
+        else if (strcmp(flag, "--threads") == 0)
+        {
+            long threads;
+
+            if (!_parseLong(value, 1, 4096, &threads))
+                return 0;
+
+            options->threads = (int)threads;
+        }
+        else if (strcmp(flag, "--seed") == 0)
+        {
+            if (!_parseSeed(value, &options->seed))
+                return 0;
+        }
+        else if (strcmp(flag, "--format") == 0)
+        {
+            if (strcmp(value, "json") != 0 && strcmp(value, "csv") != 0)
+                return 0;
+
+            options->json = strcmp(value, "json") == 0;
+        }
+        else if (strcmp(flag, "--output") == 0)
+            options->output = value;
+        else
+            return 0;
+    }
+
+    // sysconf() reports -1 when the CPU count is unknown
+    if (options->threads < 1)
+        options->threads = 1;
+
+    return options->precision > 0.0 && options->z > 0.0 && options->round_games > 0 &&
+           options->max_games >= 2 * options->pilot_games;
+}
+
+// =====================
+//  MAIN
+// =====================
+
+int main(int argc, char *argv[])
+{
+    analysis_options options;
+
+    if (!_parseOptions(argc, argv, &options))
+    {
+        _showUsage(argv[0]);
+        return 1;
+    }
+
+    int count = options.size_count * options.density_count * options.policy_count;
+    grid_point *points = malloc(count * sizeof(grid_point));
+
+    assert(points != NULL);
+
+    int index = 0;
+
+    for (int s = 0; s < options.size_count; s++)
+    {
+        for (int d = 0; d < options.density_count; d++)
+        {
+            for (int p = 0; p < options.policy_count; p++)
+            {
+                grid_point *point = &points[index++];
+                int cells = options.sizes[s][0] * options.sizes[s][1];
+                int mines = (int)(options.densities[d] * cells + 0.5);
+
+                // The 3x3 safe zone around the first click must stay clear
+                if (mines > cells - 9)
+                {
+                    fprintf(stderr, "%dx%d: density %.4f leaves no room for the safe zone, clamped to %d mines\n",
+                            options.sizes[s][0], options.sizes[s][1], options.densities[d], cells - 9);
+                    mines = cells - 9;
+                }
+                if (mines < 1)
+                    mines = 1;
+
+                point->rows = options.sizes[s][0];
+                point->cols = options.sizes[s][1];
+                point->mines = mines;
+                point->requested_density = options.densities[d];
+                point->density = (double)mines / cells;
+                point->policy = options.policies[p];
+            }
+        }
+    }
+
+    worker_pool pool;
+
+    if (_startPool(&pool, options.threads) == 0)
+    {
+        _stopPool(&pool);
+        free(points);
+        return 1;
+    }
+
+    long total_games = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        _runPoint(&points[i], i, &options, &pool);
+        total_games += points[i].pilot_games + points[i].games;
+    }
+
+    _stopPool(&pool);
+
+    // A fixed-sample design of 0/1 outcomes has to size every point for the worst case, p = 0.5;
+    // under relative precision that worst case is unbounded
+    if (!options.relative)
+    {
+        long fixed_games = (long)ceil(options.z * options.z * 0.25 / (options.precision * options.precision));
+
+        fprintf(stderr, "\n%d points, %ld games played; a fixed sample of %ld per point would need %ld\n",
+                count, total_games, fixed_games, fixed_games * count);
+    }
+    else
+        fprintf(stderr, "\n%d points, %ld games played\n", count, total_games);
+
+    FILE *out = options.output ? fopen(options.output, "w") : stdout;
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", options.output);
+        free(points);
+        return 1;
+    }
+
+    _writeReport(out, points, count, options.json);
+
+    if (out != stdout)
+        fclose(out);
+
+    free(points);
+
+    return 0;
+}